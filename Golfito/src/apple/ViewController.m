@@ -27,7 +27,10 @@ extern void _gfx_init_state (MTKView* pView, float32_t width, float32_t height);
     _viewportSize.x = _view.frame.size.width;
     _viewportSize.y = _view.frame.size.height;
     game_sys_initialize();
-    mem_initialize();
+    if (!mem_initialize()) {
+        NSLog(@"Failed to reserve memory for the allocators");
+        exit(1);
+    }
     _gfx_init_state(view, _viewportSize.x, _viewportSize.y);
     gfx_initialize();
     game_start();
@@ -43,31 +43,44 @@ fragment float4 textureColorFS (
     return color;
 }
 
-// Line Pipeline
+// Sprite Instance Pipeline
 
-struct LineVertexIn {
-    float2 position[[attribute(0)]];
-    uchar4 color[[attribute(0)]];
+struct SpriteInstance {
+    packed_float2 position;
+    packed_float2 scale;
+    float rotation;
+    packed_ushort4 frame;
+    uint color;
 };
 
-struct LineVertexOut {
-    float4 position[[position]];
-    float4 color;
+struct SpriteInstanceUniform {
+    float2 resolution;
+    float2 invTextureSize;
+    float2 axisX;
+    float2 axisY;
+    float2 translation;
 };
 
-vertex LineVertexOut lineColorVS (
-                                        uint vertexID[[vertex_id]],
-                                        device LineVertexIn* vertices[[buffer(0)]],
-                                        constant VertexUniform& uniform[[buffer(1)]]) {
-    
-    LineVertexOut out;
-    LineVertexIn vert = vertices[vertexID];
-    out.position = float4(((vert.position / uniform.resolution) * 2.0 - 1.0) * float2(1.0, -1.0), 0.0, 1.0);
-    out.color = float4(vert.color.abgr) / float4(255.0);
-    
-    return out;
-}
+vertex TextureVertexOut spriteInstanceVS (
+                               uint vertexID[[vertex_id]],
+                               uint instanceID[[instance_id]],
+                               const device SpriteInstance* instances[[buffer(0)]],
+                               constant SpriteInstanceUniform& uniform[[buffer(1)]]) {
 
-fragment float4 lineColorFS (LineVertexOut in[[stage_in]]) {
-    return in.color;
+    TextureVertexOut out;
+    SpriteInstance instance = instances[instanceID];
+    // Quad corners in the same order as the CPU path: (0,0) (0,1) (1,1) (1,0)
+    float2 corner = float2(vertexID >= 2 ? 1.0 : 0.0, (vertexID == 1 || vertexID == 2) ? 1.0 : 0.0);
+    float2 frameOffset = float2(instance.frame.xy);
+    float2 frameSize = float2(instance.frame.zw);
+    float2 local = (corner - 0.5) * frameSize * float2(instance.scale);
+    float sn = sin(instance.rotation);
+    float cs = cos(instance.rotation);
+    float2 world = float2(instance.position) + float2(cs * local.x - sn * local.y, sn * local.x + cs * local.y);
+    float2 position = uniform.axisX * world.x + uniform.axisY * world.y + uniform.translation;
+    out.position = float4(((position / uniform.resolution) * 2.0 - 1.0) * float2(1.0, -1.0), 0.0, 1.0);
+    out.texCoord = (frameOffset + corner * frameSize) * uniform.invTextureSize;
+    out.color = float4(as_type<uchar4>(instance.color).abgr) / float4(255.0);
+
+    return out;
 }
@@ -5,4 +5,9 @@
 #define GFX_DISPLAY_HEIGHT 640
 #define GFX_WINDOW_TITLE "Golfito"
 
+/* Set to 0 to compile the gfx_get_frame_stats counters out, it then returns zeros. */
+#ifndef GFX_ENABLE_STATS
+#define GFX_ENABLE_STATS 1
+#endif
+
 #endif // !_CONFIG_GFX_H_
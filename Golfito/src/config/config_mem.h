@@ -0,0 +1,85 @@
+#ifndef _CONFIG_MEM_H_
+#define _CONFIG_MEM_H_
+
+/*
+ MEM_PAGE_* flags (see memory.h) for the regions mem_initialize maps.
+ Huge pages only apply to regions of at least 2MB, which are the linear region, the
+ heap and the larger pools. Darwin can't reserve superpages, so there only the linear
+ region gets huge pages. Prefaulting moves the first-touch page faults to startup.
+*/
+#ifndef MEM_LINEAR_PAGE_FLAGS
+#define MEM_LINEAR_PAGE_FLAGS MEM_PAGE_DEFAULT
+#endif
+
+#ifndef MEM_POOL_PAGE_FLAGS
+#define MEM_POOL_PAGE_FLAGS MEM_PAGE_DEFAULT
+#endif
+
+#ifndef MEM_HEAP_PAGE_FLAGS
+#define MEM_HEAP_PAGE_FLAGS MEM_PAGE_DEFAULT
+#endif
+
+/*
+ Address space reserved for every pool class and for the heap, as a power of two. Only
+ committed pages cost memory, but iOS and tvOS cap a process's virtual address space,
+ so they reserve the same as 32 bit targets.
+*/
+#ifndef MEM_POOL_REGION_SHIFT
+#if MEM_DEFAULT_ALIGNMENT == 4 || defined(TARGET_IOS) || defined(TARGET_TVOS)
+#define MEM_POOL_REGION_SHIFT 24
+#else
+#define MEM_POOL_REGION_SHIFT 28
+#endif
+#endif
+
+#ifndef MEM_HEAP_REGION_SHIFT
+#if MEM_DEFAULT_ALIGNMENT == 4 || defined(TARGET_IOS) || defined(TARGET_TVOS)
+#define MEM_HEAP_REGION_SHIFT 28
+#else
+#define MEM_HEAP_REGION_SHIFT 32
+#endif
+#endif
+
+/* Per tag and per size class allocation counters (see mem_dump_report), compiled out of release builds by default. */
+#ifndef MEM_ENABLE_ACCOUNTING
+#if defined(_DEBUG)
+#define MEM_ENABLE_ACCOUNTING 1
+#else
+#define MEM_ENABLE_ACCOUNTING 0
+#endif
+#endif
+
+/* Allows mem_trace_begin to record every pool, heap and linear call to a file for mem_replay. */
+#ifndef MEM_ENABLE_TRACE
+#define MEM_ENABLE_TRACE 0
+#endif
+
+/*
+ Pool size classes are the powers of two from 1 << MEM_POOL_MIN_SIZE_SHIFT to
+ 1 << MEM_POOL_MAX_SIZE_SHIFT, larger requests go to the heap. Blocks hold their free
+ list link, so the smallest class is 8 bytes. MEM_POOL_INITIAL_COMMIT optionally lists
+ the bytes every pool commits at startup. mem_replay (src/linux/mem_replay.c) generates
+ these from a trace, define MEM_POOL_TABLE as the generated header's path to use it.
+*/
+#if defined(MEM_POOL_TABLE)
+#include MEM_POOL_TABLE
+#endif
+
+#ifndef MEM_POOL_MIN_SIZE_SHIFT
+#define MEM_POOL_MIN_SIZE_SHIFT 3
+#endif
+
+#ifndef MEM_POOL_MAX_SIZE_SHIFT
+#define MEM_POOL_MAX_SIZE_SHIFT 10
+#endif
+
+/* Frames whose arenas can be alive at once, which should cover the frames a backend keeps in flight. */
+#ifndef MEM_FRAME_ARENA_COUNT
+#define MEM_FRAME_ARENA_COUNT 3
+#endif
+
+#ifndef MEM_FRAME_ARENA_CAPACITY
+#define MEM_FRAME_ARENA_CAPACITY UT_MB(4)
+#endif
+
+#endif // !_CONFIG_MEM_H_
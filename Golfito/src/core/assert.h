@@ -11,6 +11,8 @@
 #elif defined(TARGET_IOS) || defined(TARGET_TVOS)
 #include <signal.h>
 #define _BREAKPOINT() raise(SIGTRAP)
+#elif defined(TARGET_LINUX)
+#define _BREAKPOINT() __builtin_trap()
 #else
 #define _BREAKPOINT __debugbreak
 #endif
@@ -19,7 +21,7 @@
 
 #else
 #define _BREAKPOINT()
-#define DBG_ASSERT(x, msg)
+#define DBG_ASSERT(x, msg, ...)
 #endif
 
 #endif
@@ -0,0 +1,127 @@
+#ifndef _ATOMIC_H_
+#define _ATOMIC_H_
+
+#include "types.h"
+#include "utils.h"
+
+/*
+ Minimal atomics over the compiler intrinsics, since MSVC has no stdatomic.h for C.
+ Loads acquire, stores release and read-modify-write operations are sequentially consistent.
+ ATOM_THREAD_LOCAL marks a global as per-thread storage.
+ The spin lock is for short critical sections that never block.
+*/
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+#define ATOM_THREAD_LOCAL __declspec(thread)
+
+static __inline uint32_t atom_load_u32(volatile uint32_t* pValue) {
+    uint32_t value = *pValue;
+    _ReadWriteBarrier();
+    return value;
+}
+
+static __inline uint64_t atom_load_u64(volatile uint64_t* pValue) {
+#if defined(_M_IX86)
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)pValue, 0, 0);
+#else
+    uint64_t value = *pValue;
+    _ReadWriteBarrier();
+    return value;
+#endif
+}
+
+static __inline void atom_store_u32(volatile uint32_t* pValue, uint32_t value) {
+    _ReadWriteBarrier();
+    *pValue = value;
+}
+
+static __inline void atom_store_u64(volatile uint64_t* pValue, uint64_t value) {
+#if defined(_M_IX86)
+    _InterlockedExchange64((volatile __int64*)pValue, (__int64)value);
+#else
+    _ReadWriteBarrier();
+    *pValue = value;
+#endif
+}
+
+static __inline bool32_t atom_cas_u64(volatile uint64_t* pValue, uint64_t expected, uint64_t desired) {
+    return (uint64_t)_InterlockedCompareExchange64((volatile __int64*)pValue, (__int64)desired, (__int64)expected) == expected;
+}
+
+static __inline uint32_t atom_exchange_u32(volatile uint32_t* pValue, uint32_t value) {
+    return (uint32_t)_InterlockedExchange((volatile long*)pValue, (long)value);
+}
+
+static __inline void atom_cpu_relax(void) {
+#if defined(_M_IX86) || defined(_M_X64)
+    _mm_pause();
+#else
+    __yield();
+#endif
+}
+
+static __inline uint64_t atom_fetch_add_u64(volatile uint64_t* pValue, uint64_t value) {
+#if defined(_M_IX86)
+    uint64_t previous = atom_load_u64(pValue);
+    while (!atom_cas_u64(pValue, previous, previous + value)) previous = atom_load_u64(pValue);
+    return previous;
+#else
+    return (uint64_t)_InterlockedExchangeAdd64((volatile __int64*)pValue, (__int64)value);
+#endif
+}
+
+#else
+
+#define ATOM_THREAD_LOCAL __thread
+
+static __inline uint32_t atom_load_u32(volatile uint32_t* pValue) {
+    return __atomic_load_n(pValue, __ATOMIC_ACQUIRE);
+}
+
+static __inline uint64_t atom_load_u64(volatile uint64_t* pValue) {
+    return __atomic_load_n(pValue, __ATOMIC_ACQUIRE);
+}
+
+static __inline void atom_store_u32(volatile uint32_t* pValue, uint32_t value) {
+    __atomic_store_n(pValue, value, __ATOMIC_RELEASE);
+}
+
+static __inline void atom_store_u64(volatile uint64_t* pValue, uint64_t value) {
+    __atomic_store_n(pValue, value, __ATOMIC_RELEASE);
+}
+
+static __inline bool32_t atom_cas_u64(volatile uint64_t* pValue, uint64_t expected, uint64_t desired) {
+    return __atomic_compare_exchange_n(pValue, &expected, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? UT_TRUE : UT_FALSE;
+}
+
+static __inline uint64_t atom_fetch_add_u64(volatile uint64_t* pValue, uint64_t value) {
+    return __atomic_fetch_add(pValue, value, __ATOMIC_SEQ_CST);
+}
+
+static __inline uint32_t atom_exchange_u32(volatile uint32_t* pValue, uint32_t value) {
+    return __atomic_exchange_n(pValue, value, __ATOMIC_ACQUIRE);
+}
+
+static __inline void atom_cpu_relax(void) {
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+#endif
+
+static __inline void atom_spin_lock(volatile uint32_t* pLock) {
+    while (atom_exchange_u32(pLock, 1) != 0) {
+        while (atom_load_u32(pLock) != 0) atom_cpu_relax();
+    }
+}
+
+static __inline void atom_spin_unlock(volatile uint32_t* pLock) {
+    atom_store_u32(pLock, 0);
+}
+
+#endif
@@ -0,0 +1,323 @@
+#ifndef _FIXED_H_
+#define _FIXED_H_
+
+#if defined __APPLE__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-function"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#endif
+
+#include <stdint.h>
+#include <math.h>
+
+/*
+ Q16.16 fixed point counterparts of the math.h vec2 and mat2d operations, for simulation that
+ has to replay bit for bit on every platform and compiler, like validating a shot on a server.
+ Only integer arithmetic is used past fxFromFloat: products are widened to 64 bits and rounded
+ once, square roots are computed bit by bit and sines come from a quarter wave table with
+ linear interpolation, so no result depends on libm or the FPU.
+ Values, lengths included, must stay within +-32768, products of two values are exact before their rounding.
+ Right shifts of negative values are assumed to be arithmetic, as on every supported compiler.
+*/
+typedef int32_t fixed_t;
+
+#define FX_SHIFT 16
+#define FX_ONE ((fixed_t)1 << FX_SHIFT)
+#define FX_HALF ((fixed_t)1 << (FX_SHIFT - 1))
+#define FX_PI ((fixed_t)205887)
+#define FX_TWO_PI ((fixed_t)411775)
+#define FX_FROM_INT(value) ((fixed_t)(value) * FX_ONE)
+/* 2^32 / (2 pi) in Q16.16, maps radians to a phase where 2^32 is one turn. */
+#define FX_RADIANS_TO_PHASE ((int64_t)683565276)
+#define FX_SIN_TABLE_SHIFT 8
+
+/* sin(i * pi / 512) for a quarter turn, generated offline so the values never depend on a libm. */
+static const fixed_t kFxSinTable[(1 << FX_SIN_TABLE_SHIFT) + 1] = {
+    0, 402, 804, 1206, 1608, 2010, 2412, 2814,
+    3216, 3617, 4019, 4420, 4821, 5222, 5623, 6023,
+    6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+    9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391,
+    12785, 13180, 13573, 13966, 14359, 14751, 15143, 15534,
+    15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699,
+    22078, 22457, 22834, 23210, 23586, 23961, 24335, 24708,
+    25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538,
+    30893, 31248, 31600, 31952, 32303, 32652, 33000, 33347,
+    33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716,
+    39040, 39362, 39683, 40002, 40320, 40636, 40951, 41264,
+    41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056,
+    46341, 46624, 46906, 47186, 47464, 47741, 48015, 48288,
+    48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398,
+    52639, 52878, 53114, 53349, 53581, 53812, 54040, 54267,
+    54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607,
+    57798, 57986, 58172, 58356, 58538, 58718, 58896, 59071,
+    59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568,
+    61705, 61839, 61971, 62101, 62228, 62353, 62476, 62596,
+    62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197,
+    64277, 64354, 64429, 64501, 64571, 64639, 64704, 64766,
+    64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436,
+    65457, 65476, 65492, 65505, 65516, 65525, 65531, 65535,
+    65536
+};
+
+struct fxvec2
+{
+    fixed_t x;
+    fixed_t y;
+};
+
+struct fxmat2d
+{
+    union
+    {
+        struct
+        {
+            fixed_t a, b, c;
+            fixed_t d, tx, ty;
+        };
+        fixed_t data[6];
+    };
+};
+
+/* fixed */
+static fixed_t fxFromFloat(float value);
+static float fxToFloat(fixed_t value);
+static fixed_t fxFromWide(int64_t value);
+static fixed_t fxMul(fixed_t a, fixed_t b);
+static fixed_t fxDiv(fixed_t a, fixed_t b);
+static fixed_t fxSqrt(fixed_t value);
+static void fxSinCos(fixed_t radian, fixed_t* pOutSin, fixed_t* pOutCos);
+
+/* fxmat2d */
+static struct fxmat2d* fxmat2dIdent(struct fxmat2d* __restrict pOut);
+static struct fxmat2d* fxmat2dMul(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM0, struct fxmat2d* __restrict pM1);
+static struct fxvec2* fxmat2DVec2Mul(struct fxvec2* __restrict pOut, struct fxmat2d* __restrict pM0, struct fxvec2* __restrict pV1);
+static struct fxmat2d* fxmat2DTranslate(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t x, fixed_t y);
+static struct fxmat2d* fxmat2DScale(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t x, fixed_t y);
+static struct fxmat2d* fxmat2DRotate(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t radian);
+
+/* fxvec2 */
+static struct fxvec2* fxvec2Add(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+static struct fxvec2* fxvec2Sub(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+static struct fxvec2* fxvec2Mul(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+static struct fxvec2* fxvec2Scale(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV, fixed_t scale);
+static struct fxvec2* fxvec2Negate(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV);
+static struct fxvec2* fxvec2Normalize(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV);
+static int32_t fxvec2Equal(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+static fixed_t fxvec2Dot(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+static fixed_t fxvec2Length(struct fxvec2* __restrict pV);
+static fixed_t fxvec2Distance(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1);
+
+/* Definition */
+typedef struct fxvec2 fxvec2_t;
+typedef struct fxmat2d fxmat2d_t;
+
+/* fixed */
+fixed_t fxFromFloat(float value)
+{
+    return (fixed_t)floorf(value * (float)FX_ONE + 0.5f);
+}
+float fxToFloat(fixed_t value)
+{
+    return (float)value * (1.0f / (float)FX_ONE);
+}
+/* Rounds a Q32.32 product or sum of products back to Q16.16, halves round up. */
+fixed_t fxFromWide(int64_t value)
+{
+    return (fixed_t)((value + FX_HALF) >> FX_SHIFT);
+}
+fixed_t fxMul(fixed_t a, fixed_t b)
+{
+    return fxFromWide((int64_t)a * b);
+}
+/* Rounds towards zero, b must not be 0. */
+fixed_t fxDiv(fixed_t a, fixed_t b)
+{
+    return (fixed_t)((int64_t)a * FX_ONE / b);
+}
+/* Square root of a Q32.32 value rounded to the nearest Q16.16, one result bit per iteration. */
+static fixed_t fxSqrtWide(uint64_t value)
+{
+    uint64_t root = 0;
+    uint64_t bit = (uint64_t)1 << 62;
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    if (value > root) root += 1;
+    return (fixed_t)root;
+}
+/* Negative values return 0. */
+fixed_t fxSqrt(fixed_t value)
+{
+    if (value <= 0) return 0;
+    return fxSqrtWide((uint64_t)value << FX_SHIFT);
+}
+/* Sine of a phase where 2^32 is one turn, interpolated from the quarter wave table. */
+static fixed_t fxSinPhase(uint32_t phase)
+{
+    uint32_t quadrant = phase >> 30;
+    uint32_t offset = phase & 0x3FFFFFFF;
+    if (quadrant & 1) offset = 0x40000000 - offset;
+    uint32_t index = offset >> (30 - FX_SIN_TABLE_SHIFT);
+    fixed_t value = kFxSinTable[index];
+    if (index < (1 << FX_SIN_TABLE_SHIFT))
+    {
+        int64_t fraction = (offset >> (30 - FX_SIN_TABLE_SHIFT - 16)) & 0xFFFF;
+        value += (fixed_t)(((int64_t)(kFxSinTable[index + 1] - value) * fraction + FX_HALF) >> 16);
+    }
+    return (quadrant & 2) ? -value : value;
+}
+/* Within 2e-5 of the exact values, about one Q16.16 step. */
+void fxSinCos(fixed_t radian, fixed_t* pOutSin, fixed_t* pOutCos)
+{
+    uint32_t phase = (uint32_t)(((int64_t)radian * FX_RADIANS_TO_PHASE) >> FX_SHIFT);
+    *pOutSin = fxSinPhase(phase);
+    *pOutCos = fxSinPhase(phase + 0x40000000);
+}
+
+/* fxmat2d */
+struct fxmat2d* fxmat2dIdent(struct fxmat2d* __restrict pOut)
+{
+    pOut->data[0] = FX_ONE;
+    pOut->data[1] = 0;
+    pOut->data[2] = 0;
+    pOut->data[3] = FX_ONE;
+    pOut->data[4] = 0;
+    pOut->data[5] = 0;
+    return pOut;
+}
+struct fxmat2d* fxmat2dMul(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM0, struct fxmat2d* __restrict pM1)
+{
+    const fixed_t* matrixA = pM0->data;
+    const fixed_t* matrixB = pM1->data;
+    pOut->data[0] = fxFromWide((int64_t)matrixA[0] * matrixB[0] + (int64_t)matrixA[1] * matrixB[2]);
+    pOut->data[1] = fxFromWide((int64_t)matrixA[0] * matrixB[1] + (int64_t)matrixA[1] * matrixB[3]);
+    pOut->data[2] = fxFromWide((int64_t)matrixA[2] * matrixB[0] + (int64_t)matrixA[3] * matrixB[2]);
+    pOut->data[3] = fxFromWide((int64_t)matrixA[2] * matrixB[1] + (int64_t)matrixA[3] * matrixB[3]);
+    pOut->data[4] = fxFromWide((int64_t)matrixA[4] * matrixB[0] + (int64_t)matrixA[5] * matrixB[2] + (int64_t)matrixB[4] * FX_ONE);
+    pOut->data[5] = fxFromWide((int64_t)matrixA[4] * matrixB[1] + (int64_t)matrixA[5] * matrixB[3] + (int64_t)matrixB[5] * FX_ONE);
+    return pOut;
+}
+struct fxvec2* fxmat2DVec2Mul(struct fxvec2* __restrict pOut, struct fxmat2d* __restrict pM0, struct fxvec2* __restrict pV1)
+{
+    pOut->x = fxFromWide((int64_t)pV1->x * pM0->a + (int64_t)pV1->y * pM0->c + (int64_t)pM0->tx * FX_ONE);
+    pOut->y = fxFromWide((int64_t)pV1->x * pM0->b + (int64_t)pV1->y * pM0->d + (int64_t)pM0->ty * FX_ONE);
+    return pOut;
+}
+struct fxmat2d* fxmat2DTranslate(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t x, fixed_t y)
+{
+    pOut->data[4] = fxFromWide((int64_t)pM->data[0] * x + (int64_t)pM->data[2] * y + (int64_t)pM->data[4] * FX_ONE);
+    pOut->data[5] = fxFromWide((int64_t)pM->data[1] * x + (int64_t)pM->data[3] * y + (int64_t)pM->data[5] * FX_ONE);
+    return pOut;
+}
+struct fxmat2d* fxmat2DScale(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t x, fixed_t y)
+{
+    pOut->data[0] = fxMul(pM->data[0], x);
+    pOut->data[1] = fxMul(pM->data[1], x);
+    pOut->data[2] = fxMul(pM->data[2], y);
+    pOut->data[3] = fxMul(pM->data[3], y);
+    return pOut;
+}
+struct fxmat2d* fxmat2DRotate(struct fxmat2d* __restrict pOut, struct fxmat2d* __restrict pM, fixed_t radian)
+{
+    fixed_t sn, cs;
+    fxSinCos(radian, &sn, &cs);
+    pOut->data[0] = fxFromWide((int64_t)cs * pM->data[0] + (int64_t)sn * pM->data[2]);
+    pOut->data[1] = fxFromWide((int64_t)cs * pM->data[1] + (int64_t)sn * pM->data[3]);
+    pOut->data[2] = fxFromWide(-(int64_t)sn * pM->data[0] + (int64_t)cs * pM->data[2]);
+    pOut->data[3] = fxFromWide(-(int64_t)sn * pM->data[1] + (int64_t)cs * pM->data[3]);
+    return pOut;
+}
+
+/* fxvec2 */
+struct fxvec2* fxvec2Add(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    pOut->x = pV0->x + pV1->x;
+    pOut->y = pV0->y + pV1->y;
+    return pOut;
+}
+struct fxvec2* fxvec2Sub(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    pOut->x = pV0->x - pV1->x;
+    pOut->y = pV0->y - pV1->y;
+    return pOut;
+}
+struct fxvec2* fxvec2Mul(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    pOut->x = fxMul(pV0->x, pV1->x);
+    pOut->y = fxMul(pV0->y, pV1->y);
+    return pOut;
+}
+struct fxvec2* fxvec2Scale(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV, fixed_t scale)
+{
+    pOut->x = fxMul(pV->x, scale);
+    pOut->y = fxMul(pV->y, scale);
+    return pOut;
+}
+struct fxvec2* fxvec2Negate(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV)
+{
+    pOut->x = -pV->x;
+    pOut->y = -pV->y;
+    return pOut;
+}
+/* The zero vector stays zero. */
+struct fxvec2* fxvec2Normalize(struct fxvec2* __restrict pOut, struct fxvec2* __restrict pV)
+{
+    fixed_t length = fxvec2Length(pV);
+    if (length == 0)
+    {
+        pOut->x = 0;
+        pOut->y = 0;
+        return pOut;
+    }
+    pOut->x = fxDiv(pV->x, length);
+    pOut->y = fxDiv(pV->y, length);
+    return pOut;
+}
+int32_t fxvec2Equal(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    return pV0->x == pV1->x && pV0->y == pV1->y;
+}
+fixed_t fxvec2Dot(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    return fxFromWide((int64_t)pV0->x * pV1->x + (int64_t)pV0->y * pV1->y);
+}
+fixed_t fxvec2Length(struct fxvec2* __restrict pV)
+{
+    /* Each square is below 2^62, so their sum fits unsigned. */
+    return fxSqrtWide((uint64_t)((int64_t)pV->x * pV->x) + (uint64_t)((int64_t)pV->y * pV->y));
+}
+fixed_t fxvec2Distance(struct fxvec2* __restrict pV0, struct fxvec2* __restrict pV1)
+{
+    struct fxvec2 difference;
+    fxvec2Sub(&difference, pV0, pV1);
+    return fxvec2Length(&difference);
+}
+
+#if defined(__APPLE__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // !_FIXED_H_
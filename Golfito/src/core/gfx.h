@@ -22,6 +22,30 @@ typedef void* TextureID;
 #define PIPELINE_TEXTURE 0
 #define PIPELINE_LINE 1
 
+/* A sprite centered at position, scaled, then rotated by rotation radians. The frame rect is in texels. */
+typedef struct {
+    vec2_t position;
+    vec2_t scale;
+    float32_t rotation;
+    uint16_t frameX, frameY;
+    uint16_t frameW, frameH;
+    uint32_t color;
+} SpriteInstance;
+
+/* Counters of the last finished frame. Vertices count every quad corner written, points every gfx_vertex2 call. */
+typedef struct {
+    uint32_t drawCalls;
+    uint32_t batches;
+    uint32_t vertices;
+    uint32_t instances;
+    uint32_t points;
+    uint32_t flushes;
+    uint32_t capFlushes;        /* flushes forced because a staging array was full */
+    uint32_t pipelineSwitches;
+    uint64_t vertexBytes;       /* copied into GPU vertex and instance buffers */
+    uint64_t uniformBytes;
+} GfxFrameStats;
+
 void gfx_initialize(void);
 void gfx_shutdown(void);
 void gfx_begin(void);
@@ -35,6 +59,13 @@ void gfx_draw_texture(TextureID texture, float32_t x, float32_t y);
 void gfx_draw_texture_with_color(TextureID texture, float32_t x, float32_t y, uint32_t color);
 void gfx_draw_texture_frame(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh);
 void gfx_draw_texture_frame_with_color(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, uint32_t color);
+/*
+ Draws a frame centered at (x, y), scaled, then rotated by rotation radians, like a SpriteInstance.
+ Same result as push, translate, rotate, scale, drawing the frame at -size/2 and pop, without touching the matrix stack.
+*/
+void gfx_draw_texture_frame_trs(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, float32_t rotation, float32_t scaleX, float32_t scaleY);
+void gfx_draw_texture_frame_trs_with_color(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, float32_t rotation, float32_t scaleX, float32_t scaleY, uint32_t color);
+void gfx_draw_sprite_instances(TextureID texture, const SpriteInstance* pInstances, uint32_t count);
 vec2_t gfx_get_texture_size(TextureID texture);
 vec2_t gfx_get_view_size(void);
 void gfx_push_matrix(void);
@@ -42,12 +73,28 @@ void gfx_pop_matrix(void);
 void gfx_translate(float32_t x, float32_t y);
 void gfx_scale(float32_t x, float32_t y);
 void gfx_rotate(float32_t r);
+/* Same as gfx_rotate for a rotation kept as a rot2, see math.h. */
+void gfx_rotate_rot2(rot2_t rotation);
 void gfx_load_identity(void);
 void gfx_vertex2(float32_t x, float32_t y, uint32_t color);
 void gfx_line(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color);
 void gfx_line2(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color0, uint32_t color1);
 
 bool32_t gfx_set_pipeline(uint32_t pipeline);
+
+/*
+ Deferred mode tags every draw with a sort key (layer, pipeline, texture, depth) and sorts
+ them at gfx_flush, so the batch count follows the number of distinct states instead of how
+ draws are interleaved. Lower layers draw first. Depth only orders draws that share a layer,
+ pipeline and texture, a far sprite on one texture can still draw after a near sprite on
+ another. Alpha blended draws that have to overlap back to front across textures need their
+ own layers. Draws with equal keys keep their call order. Sprite instances are expanded on
+ the CPU while deferred so each gets a key.
+*/
+void gfx_set_deferred(bool32_t enabled);
+void gfx_set_sort_layer(uint32_t layer);
+void gfx_set_sort_depth(float32_t depth);
 float32_t gfx_get_pixel_ratio(void);
+GfxFrameStats gfx_get_frame_stats(void);
 
 #endif
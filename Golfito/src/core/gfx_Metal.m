@@ -2,94 +2,53 @@
 #import <Foundation/Foundation.h>
 #include "math.h"
 #include "gfx.h"
+#include "gfx_batch.h"
 #include "utils.h"
+#include "memory.h"
 #include <stdlib.h>
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 #include "assert.h"
-#include "memory.h"
-#import <GLKit/GLKMath.h>
 
 
-static const uint32_t kMaxMatrices = 100;
-static const uint32_t kMaxPipelines = 2;
 static const uint32_t kMaxFrames = 3;
-static const uint32_t kMaxQuads = 16000;
-static const uint32_t kMaxBatches = 1000;
-static const uint32_t kMaxVertices = kMaxQuads * 6;
-static const uint32_t kMaxPoints = 10000;
-
-typedef struct {
-    mat2d_t matrices[kMaxMatrices];
-    mat2d_t matrix;
-    uint32_t index;
-} MatrixStack;
-
-typedef struct {
-    GLKVector2 position;
-    GLKVector2 texCoord;
-    uint32_t color;
-} TextureColorVertex;
+/* Every flush in a frame copies the batch arrays into its own staging buffer laid out as vertices | instances. */
+static const size_t kStagingInstanceOffset = sizeof(TextureColorVertex) * GFX_MAX_VERTICES;
+static const size_t kStagingSize = kStagingInstanceOffset + sizeof(SpriteInstance) * GFX_MAX_INSTANCES;
 
 typedef struct {
-    GLKVector2 position;
-    uint32_t color;
-} PointVertex;
-
-typedef struct {
-    GLKVector2 resolution;
+    vec2_t resolution;
 } BaseShaderUniform;
 
 typedef struct {
-    TextureID texture;
-    uint32_t vertexCount;
-    uint32_t offset;
-} DrawBatch;
+    vec2_t resolution;
+    vec2_t invTextureSize;
+    vec2_t axisX;
+    vec2_t axisY;
+    vec2_t translation;
+} SpriteInstanceUniform;
 
 typedef struct {
-    PageAllocation pageAlloc;
-    DrawBatch* pBuffer;
-    uint32_t count;
-} DrawBatchBuffer;
-
-typedef struct {
-    PageAllocation pageAlloc;
-    TextureColorVertex* pBuffer;
-    uint32_t count;
-} TextureColorVertexBuffer;
-
-typedef struct {
-    PageAllocation pageAlloc;
-    PointVertex* pBuffer;
-    uint32_t count;
-} PointBuffer;
-
-typedef struct {
-    MatrixStack matrixStack;
     BaseShaderUniform uniformData;
     vec2_t viewportSize;
-    DrawBatchBuffer batchBuffer;
-    TextureColorVertexBuffer vertices;
-    PointBuffer points;
     id<MTLDevice> device;
     id<MTLCommandQueue> cmdQueue;
-    id<MTLRenderPipelineState> pipelines[kMaxPipelines];
-    id<MTLRenderPipelineState> currentPipeline;
-    id<MTLBuffer> vertexBuffer[kMaxFrames];
-    id<MTLBuffer> pointVertexBuffer[kMaxFrames];
+    id<MTLRenderPipelineState> textureColorPipeline;
+    id<MTLRenderPipelineState> spriteInstancePipeline;
+    NSMutableArray<id<MTLBuffer>>* stagingBuffers[kMaxFrames];
+    uint32_t stagingIdx;
+    id<MTLBuffer> quadIndexBuffer;
     id<MTLLibrary> defaultLibrary;
     id<MTLCommandBuffer> cmdBuffer;
     id<MTLRenderCommandEncoder> renderCmdEncoder;
     MTLLoadAction framebufferLoadAction;
     dispatch_semaphore_t frameSemaphore;
     MTKView* metalKitView;
-    DrawBatch* pCurrentBatch;
-    TextureID currentTexture;
     MTLClearColor clearColor;
     MTLViewport viewport;
-    uint32_t pipelineID;
     float32_t pixelScale;
     uint32_t frameIdx;
+    uint64_t memFrameIdx;
 } GfxStateMetal;
 
 static GfxStateMetal gGfxState = { 0 };
@@ -97,38 +56,26 @@ NSBundle* gAssetBundle = NULL;
 
 void gfx_initialize (void) {
     gAssetBundle = [NSBundle mainBundle];
-    
-    DBG_ASSERT(mem_page_alloc(sizeof(PointVertex) * kMaxPoints, &gGfxState.points.pageAlloc), "Failed to allocate buffer for points");
-    DBG_ASSERT(mem_page_alloc(sizeof(TextureColorVertex) * kMaxVertices, &gGfxState.vertices.pageAlloc), "Failed to allocate buffer for vertices");
-    DBG_ASSERT(mem_page_alloc(sizeof(DrawBatch) * kMaxBatches, &gGfxState.batchBuffer.pageAlloc), "Failed to allocate buffer for draw batching");
-    
-    gGfxState.points.pBuffer = (PointVertex*)gGfxState.points.pageAlloc.pAddress;
-    gGfxState.vertices.pBuffer = (TextureColorVertex*)gGfxState.vertices.pageAlloc.pAddress;
-    gGfxState.batchBuffer.pBuffer = (DrawBatch*)gGfxState.batchBuffer.pageAlloc.pAddress;
-    gGfxState.vertices.count = 0;
-    gGfxState.points.count = 0;
-    gGfxState.batchBuffer.count = 0;
-    gGfxState.currentTexture = ((void*)0xDEADBEEF);
-    gGfxState.pCurrentBatch = NULL;
+    _gfx_batch_initialize();
     for (uint32_t index = 0; index < kMaxFrames; ++index) {
-        gGfxState.pointVertexBuffer[index] = [gGfxState.device newBufferWithLength:sizeof(PointVertex)*kMaxPoints options:MTLResourceStorageModeShared];
-        gGfxState.vertexBuffer[index] = [gGfxState.device newBufferWithLength:sizeof(TextureColorVertex)*kMaxVertices options:MTLResourceStorageModeShared];
+        gGfxState.stagingBuffers[index] = [[NSMutableArray alloc] init];
+        [gGfxState.stagingBuffers[index] addObject:[gGfxState.device newBufferWithLength:kStagingSize options:MTLResourceStorageModeShared]];
     }
+    _gfx_batch_set_instancing(UT_TRUE);
+    gGfxState.quadIndexBuffer = [gGfxState.device newBufferWithBytes:gGfxBatch.pQuadIndices length:sizeof(uint16_t)*GFX_MAX_INDICES options:MTLResourceStorageModeShared];
     gGfxState.frameIdx = 0;
-    gGfxState.matrixStack.index = 0;
-    mat2dIdent(&gGfxState.matrixStack.matrix);
-    gGfxState.currentPipeline = NULL;
-    gGfxState.pipelineID = (uint32_t)-1;
-    gfx_set_pipeline(PIPELINE_TEXTURE);
+    gGfxState.stagingIdx = 0;
     gGfxState.framebufferLoadAction = MTLLoadActionClear;
 }
 void gfx_shutdown(void) {
-
+    _gfx_batch_shutdown();
 }
 void gfx_begin (void) {
     gGfxState.frameIdx = (gGfxState.frameIdx + 1) % kMaxFrames;
 
     dispatch_semaphore_wait(gGfxState.frameSemaphore, DISPATCH_TIME_FOREVER);
+    gGfxState.memFrameIdx = mem_frame_begin();
+    gGfxState.stagingIdx = 0;
     MTLRenderPassDescriptor* pCurrentRenderPassDesc = gGfxState.metalKitView.currentRenderPassDescriptor;
     pCurrentRenderPassDesc.colorAttachments[0].clearColor = gGfxState.clearColor;
     pCurrentRenderPassDesc.colorAttachments[0].loadAction = gGfxState.framebufferLoadAction;
@@ -153,78 +100,93 @@ void gfx_begin (void) {
     MTLViewport viewport = { 0.0, 0.0, gGfxState.viewportSize.x * gGfxState.pixelScale, gGfxState.viewportSize.y * gGfxState.pixelScale, -10.0, 10.0 };
     gGfxState.viewport = viewport;
 }
-void _gfx_force_end_no_present (void) {
-    gfx_flush();
-    [gGfxState.renderCmdEncoder endEncoding];
-    __weak dispatch_semaphore_t semaphore = gGfxState.frameSemaphore;
-    [gGfxState.cmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> commandBuffer) {
-        // GPU work is complete
-        // Signal the semaphore to start the CPU work
-        dispatch_semaphore_signal(semaphore);
-    }];
-    
-    [gGfxState.cmdBuffer commit];
-    gGfxState.cmdBuffer = NULL;
-    gGfxState.renderCmdEncoder = NULL;
-    gGfxState.frameIdx = (gGfxState.frameIdx + 1) % kMaxFrames;
-}
 void gfx_end (void) {
     gfx_flush();
     [gGfxState.renderCmdEncoder endEncoding];
     [gGfxState.cmdBuffer presentDrawable:gGfxState.metalKitView.currentDrawable];
     __weak dispatch_semaphore_t semaphore = gGfxState.frameSemaphore;
+    uint64_t memFrameIdx = gGfxState.memFrameIdx;
     [gGfxState.cmdBuffer addCompletedHandler:^(id<MTLCommandBuffer> commandBuffer) {
         // GPU work is complete
-        // Signal the semaphore to start the CPU work
+        // The frame's arena can be reused and signal the semaphore to start the CPU work
+        mem_frame_retire(memFrameIdx);
         dispatch_semaphore_signal(semaphore);
     }];
     
     [gGfxState.cmdBuffer commit];
     gGfxState.cmdBuffer = NULL;
     gGfxState.renderCmdEncoder = NULL;
+    _gfx_batch_end_frame();
+}
+
+/* Staging buffers of a frame are only reused once its command buffer is done, so extra flushes grow the frame's list. */
+static id<MTLBuffer> _gfx_next_staging_buffer (void) {
+    NSMutableArray<id<MTLBuffer>>* pBuffers = gGfxState.stagingBuffers[gGfxState.frameIdx];
+    if (gGfxState.stagingIdx >= pBuffers.count) {
+        [pBuffers addObject:[gGfxState.device newBufferWithLength:kStagingSize options:MTLResourceStorageModeShared]];
+    }
+    return pBuffers[gGfxState.stagingIdx++];
 }
 
 static void _gfx_flush_no_clear (void) {
-    uint32_t count = gGfxState.batchBuffer.count;
-    DrawBatch* pBatches = gGfxState.batchBuffer.pBuffer;
+    uint32_t count = gGfxBatch.batchBuffer.count;
+    DrawBatch* pBatches = gGfxBatch.batchBuffer.pBuffer;
     id<MTLRenderCommandEncoder> renderEncoder = gGfxState.renderCmdEncoder;
     
     [renderEncoder setViewport:gGfxState.viewport];
     [renderEncoder setCullMode:MTLCullModeNone];
+    GFX_STATS_ADD(flushes, 1);
+    GFX_STATS_ADD(batches, count);
     
-    if (gGfxState.pipelineID == PIPELINE_TEXTURE) {
-        if (count > 0 && gGfxState.vertices.count > 0) {
-            size_t size = gGfxState.vertices.count * sizeof(TextureColorVertex);
-            void* pVBuffer = gGfxState.vertexBuffer[gGfxState.frameIdx].contents;
-            memcpy(pVBuffer, (void*)gGfxState.vertices.pBuffer, size);
-            [renderEncoder setRenderPipelineState:gGfxState.pipelines[PIPELINE_TEXTURE]];
-            [renderEncoder setVertexBuffer:gGfxState.vertexBuffer[gGfxState.frameIdx] offset:0 atIndex:0];
-            [renderEncoder setVertexBytes:&gGfxState.uniformData length:sizeof(BaseShaderUniform) atIndex:1];
-            for (uint32_t index = 0; index < count; ++index) {
-                DrawBatch* pBatch = &pBatches[index];
-                id<MTLTexture> mtlTexture = ((__bridge id<MTLTexture>)pBatch->texture);
-                [renderEncoder setFragmentTexture:mtlTexture atIndex:0];
-                [renderEncoder drawPrimitives:MTLPrimitiveTypeTriangle vertexStart:pBatch->offset vertexCount:pBatch->vertexCount];
+    if (count > 0) {
+        id<MTLBuffer> stagingBuffer = _gfx_next_staging_buffer();
+        uint8_t* pStaging = (uint8_t*)stagingBuffer.contents;
+        memcpy(pStaging, (void*)gGfxBatch.vertices.pBuffer, gGfxBatch.vertices.count * sizeof(TextureColorVertex));
+        memcpy(pStaging + kStagingInstanceOffset, (void*)gGfxBatch.instances.pBuffer, gGfxBatch.instances.count * sizeof(SpriteInstance));
+        GFX_STATS_ADD(vertexBytes, gGfxBatch.vertices.count * sizeof(TextureColorVertex) + gGfxBatch.instances.count * sizeof(SpriteInstance));
+        uint32_t boundType = (uint32_t)-1;
+        for (uint32_t index = 0; index < count; ++index) {
+            DrawBatch* pBatch = &pBatches[index];
+            id<MTLTexture> mtlTexture = ((__bridge id<MTLTexture>)pBatch->texture);
+            [renderEncoder setFragmentTexture:mtlTexture atIndex:0];
+            if (pBatch->type == GFX_BATCH_QUADS) {
+                if (boundType != GFX_BATCH_QUADS) {
+                    [renderEncoder setRenderPipelineState:gGfxState.textureColorPipeline];
+                    [renderEncoder setVertexBuffer:stagingBuffer offset:0 atIndex:0];
+                    [renderEncoder setVertexBytes:&gGfxState.uniformData length:sizeof(BaseShaderUniform) atIndex:1];
+                    GFX_STATS_ADD(uniformBytes, sizeof(BaseShaderUniform));
+                    boundType = GFX_BATCH_QUADS;
+                }
+                [renderEncoder drawIndexedPrimitives:MTLPrimitiveTypeTriangle indexCount:pBatch->count indexType:MTLIndexTypeUInt16 indexBuffer:gGfxState.quadIndexBuffer indexBufferOffset:pBatch->offset * sizeof(uint16_t)];
+                GFX_STATS_ADD(drawCalls, 1);
+            } else {
+                if (boundType != GFX_BATCH_INSTANCES) {
+                    [renderEncoder setRenderPipelineState:gGfxState.spriteInstancePipeline];
+                    boundType = GFX_BATCH_INSTANCES;
+                }
+                SpriteInstanceUniform uniform;
+                uniform.resolution = gGfxState.uniformData.resolution;
+                uniform.invTextureSize.x = 1.0f / (float32_t)mtlTexture.width;
+                uniform.invTextureSize.y = 1.0f / (float32_t)mtlTexture.height;
+                uniform.axisX.x = pBatch->transform.a;
+                uniform.axisX.y = pBatch->transform.b;
+                uniform.axisY.x = pBatch->transform.c;
+                uniform.axisY.y = pBatch->transform.d;
+                uniform.translation.x = pBatch->transform.tx;
+                uniform.translation.y = pBatch->transform.ty;
+                [renderEncoder setVertexBuffer:stagingBuffer offset:kStagingInstanceOffset + pBatch->offset * sizeof(SpriteInstance) atIndex:0];
+                [renderEncoder setVertexBytes:&uniform length:sizeof(SpriteInstanceUniform) atIndex:1];
+                [renderEncoder drawIndexedPrimitives:MTLPrimitiveTypeTriangle indexCount:6 indexType:MTLIndexTypeUInt16 indexBuffer:gGfxState.quadIndexBuffer indexBufferOffset:0 instanceCount:pBatch->count];
+                GFX_STATS_ADD(uniformBytes, sizeof(SpriteInstanceUniform));
+                GFX_STATS_ADD(drawCalls, 1);
             }
         }
-    } else if (gGfxState.pipelineID == PIPELINE_LINE) {
-        if (gGfxState.points.count > 0) {
-            size_t size = gGfxState.points.count * sizeof(PointVertex);
-            memcpy(gGfxState.pointVertexBuffer[gGfxState.frameIdx].contents, (void*)gGfxState.points.pBuffer, size);
-            [renderEncoder setRenderPipelineState:gGfxState.pipelines[PIPELINE_LINE]];
-            [renderEncoder setVertexBuffer:gGfxState.pointVertexBuffer[gGfxState.frameIdx] offset:0 atIndex:0];
-            [renderEncoder setVertexBytes:&gGfxState.uniformData length:sizeof(BaseShaderUniform) atIndex:1];
-            [renderEncoder drawPrimitives:MTLPrimitiveTypeLine vertexStart:0 vertexCount:gGfxState.points.count];
-        }
     }
 }
 void gfx_flush (void) {
+    _gfx_batch_sort();
     _gfx_flush_no_clear();
-    gGfxState.currentTexture = (void*)0xDEADBEEF;
-    gGfxState.pCurrentBatch = NULL;
-    gGfxState.batchBuffer.count = 0;
-    gGfxState.vertices.count = 0;
-    gGfxState.points.count = 0;
+    _gfx_batch_reset();
 }
 
 void gfx_resize (float32_t width, float32_t height) {
@@ -274,7 +236,7 @@ void _gfx_init_state (MTKView* pView, float32_t width, float32_t height) {
         pRenderPipelineDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
         
         NSError* pError = NULL;
-        gGfxState.pipelines[0] = [gGfxState.device newRenderPipelineStateWithDescriptor:pRenderPipelineDesc error:&pError];
+        gGfxState.textureColorPipeline = [gGfxState.device newRenderPipelineStateWithDescriptor:pRenderPipelineDesc error:&pError];
         if (pError) {
             NSLog(@"Failed to create Texture Color Pipeline:\n%@", pError);
             exit(1);
@@ -282,27 +244,15 @@ void _gfx_init_state (MTKView* pView, float32_t width, float32_t height) {
         }
     }
     
-    // Line Color Pipeline
+    // Sprite Instance Pipeline, reads SpriteInstance records straight from buffer 0
     {
-        id<MTLFunction> lineColorVS = [gGfxState.defaultLibrary newFunctionWithName:@"lineColorVS"];
-        id<MTLFunction> lineColorFS = [gGfxState.defaultLibrary newFunctionWithName:@"lineColorFS"];
-        
-        MTLVertexDescriptor* pVertexDescriptor = [[MTLVertexDescriptor alloc] init];
-        pVertexDescriptor.attributes[0].offset = offsetof(PointVertex, position);
-        pVertexDescriptor.attributes[0].format = MTLVertexFormatFloat2;
-        pVertexDescriptor.attributes[0].bufferIndex = 0;
-        pVertexDescriptor.attributes[1].offset = offsetof(PointVertex, color);
-        pVertexDescriptor.attributes[1].format = MTLVertexFormatUChar4;
-        pVertexDescriptor.attributes[1].bufferIndex = 0;
-        pVertexDescriptor.layouts[0].stepRate = 1;
-        pVertexDescriptor.layouts[0].stepFunction = MTLVertexStepFunctionPerVertex;
-        pVertexDescriptor.layouts[0].stride = sizeof(PointVertex);
+        id<MTLFunction> spriteInstanceVS = [gGfxState.defaultLibrary newFunctionWithName:@"spriteInstanceVS"];
+        id<MTLFunction> textureColorFS = [gGfxState.defaultLibrary newFunctionWithName:@"textureColorFS"];
         
         MTLRenderPipelineDescriptor* pRenderPipelineDesc = [[MTLRenderPipelineDescriptor alloc] init];
-        pRenderPipelineDesc.label = @"Line Color Pipeline";
-        pRenderPipelineDesc.vertexFunction = lineColorVS;
-        pRenderPipelineDesc.fragmentFunction = lineColorFS;
-        pRenderPipelineDesc.vertexDescriptor = pVertexDescriptor;
+        pRenderPipelineDesc.label = @"Sprite Instance Pipeline";
+        pRenderPipelineDesc.vertexFunction = spriteInstanceVS;
+        pRenderPipelineDesc.fragmentFunction = textureColorFS;
         pRenderPipelineDesc.colorAttachments[0].pixelFormat = pView.colorPixelFormat;
         pRenderPipelineDesc.colorAttachments[0].blendingEnabled = YES;
         pRenderPipelineDesc.colorAttachments[0].rgbBlendOperation = MTLBlendOperationAdd;
@@ -313,13 +263,12 @@ void _gfx_init_state (MTKView* pView, float32_t width, float32_t height) {
         pRenderPipelineDesc.colorAttachments[0].destinationAlphaBlendFactor = MTLBlendFactorOneMinusSourceAlpha;
         
         NSError* pError = NULL;
-        gGfxState.pipelines[1] = [gGfxState.device newRenderPipelineStateWithDescriptor:pRenderPipelineDesc error:&pError];
+        gGfxState.spriteInstancePipeline = [gGfxState.device newRenderPipelineStateWithDescriptor:pRenderPipelineDesc error:&pError];
         if (pError) {
-            NSLog(@"Failed to create Line Color Pipeline:\n%@", pError);
+            NSLog(@"Failed to create Sprite Instance Pipeline:\n%@", pError);
             exit(1);
             return;
         }
-
     }
     
     MTLClearColor clearColor = { 0.0f, 0.0f, 0.0f, 1.0f };
@@ -354,158 +303,49 @@ TextureID gfx_create_texture(uint32_t width, uint32_t height, const void* pPixel
     return pOpaque;
 }
 
-TextureID gfx_load_texture(const char* pTexturePath) {
+byte_t* _gfx_load_image(const char* pImagePath, uint32_t* pWidth, uint32_t* pHeight) {
     int x,y,c;
-    NSString* str = [[NSString alloc] initWithCString:pTexturePath encoding:NSASCIIStringEncoding];
+    NSString* str = [[NSString alloc] initWithCString:pImagePath encoding:NSASCIIStringEncoding];
     NSString* path = [gAssetBundle pathForResource:str ofType:NULL];
     if (!path) {
         NSLog(@"Failed to load image %@", str);
-        return INVALID_TEXTURE_ID;
+        return NULL;
     }
     uint8_t* pPixels = stbi_load([path UTF8String], &x, &y, &c, 4);
     if (pPixels==NULL) {
         NSLog(@"Failed to load image %@", path);
-        return INVALID_TEXTURE_ID;
+        return NULL;
     }
-    return gfx_create_texture(x, y, pPixels);
+    *pWidth = (uint32_t)x;
+    *pHeight = (uint32_t)y;
+    return pPixels;
 }
 
-vec2_t gfx_get_texture_size(TextureID texture) {
-    id<MTLTexture> mtlTexture = ((__bridge id<MTLTexture>)texture);
-    vec2_t size = { (float32_t)mtlTexture.width, (float32_t)mtlTexture.height };
-    return size;
+void _gfx_free_image(byte_t* pPixels) {
+    stbi_image_free(pPixels);
 }
 
-static __attribute__((always_inline)) inline TextureColorVertex _transform_vertex (float32_t x, float32_t y, float32_t u ,float32_t v, uint32_t color) {
-    vec2_t output = { 0.0f, 0.0f };
-    vec2_t input = { x, y };
-    mat2DVec2Mul(&output, &gGfxState.matrixStack.matrix, &input);
-    TextureColorVertex vertex = { { output.x, output.y }, { u, v }, color };
-    return vertex;
-}
-
-static __attribute__((always_inline)) inline void _push_quad(float32_t x, float32_t y, float32_t w, float32_t h, float32_t u0, float32_t v0, float32_t u1, float32_t v1, uint32_t color) {
-    if (gGfxState.vertices.count >= kMaxVertices) return;
-    TextureColorVertex vert0 = _transform_vertex(x, y, u0, v0, color);
-    TextureColorVertex vert1 = _transform_vertex(x, y + h, u0, v1, color);
-    TextureColorVertex vert2 = _transform_vertex(x + w, y + h, u1, v1, color);
-    TextureColorVertex vert3 = _transform_vertex(x + w, y, u1, v0, color);
-    TextureColorVertex* pVertices = &gGfxState.vertices.pBuffer[gGfxState.vertices.count];
-    pVertices[0] = vert0;
-    pVertices[1] = vert1;
-    pVertices[2] = vert2;
-    pVertices[3] = vert0;
-    pVertices[4] = vert2;
-    pVertices[5] = vert3;
-    gGfxState.vertices.count += 6;
-    gGfxState.pCurrentBatch->vertexCount += 6;
-}
-
-static void _create_batch(TextureID texture, uint32_t vertexCount, uint32_t offset) {
-    DrawBatch batch = { .texture = texture, .vertexCount = vertexCount, .offset = offset };
-    DrawBatch* pDst = &gGfxState.batchBuffer.pBuffer[gGfxState.batchBuffer.count];
-    *pDst = batch;
-    gGfxState.pCurrentBatch = &gGfxState.batchBuffer.pBuffer[gGfxState.batchBuffer.count++];
-}
-
-static id<MTLTexture> _check_tex_batch(TextureID texId) {
-    if (texId != gGfxState.currentTexture) {
-        _create_batch(texId, 0, gGfxState.vertices.count);
-        gGfxState.currentTexture = texId;
+TextureID gfx_load_texture(const char* pTexturePath) {
+    uint32_t width = 0, height = 0;
+    byte_t* pPixels = _gfx_load_image(pTexturePath, &width, &height);
+    if (pPixels == NULL) {
+        return INVALID_TEXTURE_ID;
     }
-    id<MTLTexture> mtlTexture = ((__bridge id<MTLTexture>)texId);
-    return mtlTexture;
-}
-
-void gfx_draw_texture(TextureID texture, float32_t x, float32_t y) {
-    gfx_draw_texture_with_color(texture, x, y, 0xFFFFFFFF);
+    TextureID texture = gfx_create_texture(width, height, pPixels);
+    _gfx_free_image(pPixels);
+    return texture;
 }
 
-void gfx_draw_texture_with_color(TextureID texture, float32_t x, float32_t y, uint32_t color) {
-    DBG_ASSERT(gGfxState.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
-    id<MTLTexture> mtlTexture = _check_tex_batch(texture);
-    float32_t width = (float32_t)mtlTexture.width;
-    float32_t height = (float32_t)mtlTexture.height;
-    _push_quad(x, y, width, height, 0.0f, 0.0f, 1.0f, 1.0f, color);
-}
-void gfx_draw_texture_frame(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh) {
-    gfx_draw_texture_frame_with_color(texture, x, y, fx, fy, fw, fh, 0xFFFFFFFF);
-}
-void gfx_draw_texture_frame_with_color(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, uint32_t color) {
-    DBG_ASSERT(gGfxState.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
-    id<MTLTexture> mtlTexture = _check_tex_batch(texture);
-    float32_t width = (float32_t)mtlTexture.width;
-    float32_t height = (float32_t)mtlTexture.height;
-    float32_t u0 = fx / width;
-    float32_t v0 = fy / height;
-    float32_t u1 = (fx + fw) / width;
-    float32_t v1 = (fy + fh) / height;
-    _push_quad(x, y, fw, fh, u0, v0, u1, v1, color);
+vec2_t gfx_get_texture_size(TextureID texture) {
+    id<MTLTexture> mtlTexture = ((__bridge id<MTLTexture>)texture);
+    vec2_t size = { (float32_t)mtlTexture.width, (float32_t)mtlTexture.height };
+    return size;
 }
 
 vec2_t gfx_get_view_size (void) {
     return gGfxState.viewportSize;
 }
 
-void gfx_push_matrix (void) {
-    if (gGfxState.matrixStack.index < kMaxMatrices) {
-        gGfxState.matrixStack.matrices[gGfxState.matrixStack.index++] = gGfxState.matrixStack.matrix;
-    }
-}
-void gfx_pop_matrix (void) {
-    if (gGfxState.matrixStack.index > 0) {
-        gGfxState.matrixStack.matrix = gGfxState.matrixStack.matrices[--gGfxState.matrixStack.index];
-    }
-}
-void gfx_translate (float32_t x, float32_t y) {
-    mat2d_t result = gGfxState.matrixStack.matrix;
-    mat2DTranslate(&result, &gGfxState.matrixStack.matrix, x, y);
-    gGfxState.matrixStack.matrix = result;
-}
-void gfx_scale (float32_t x, float32_t y) {
-    mat2d_t result = gGfxState.matrixStack.matrix;
-    mat2DScale(&result, &gGfxState.matrixStack.matrix, x, y);
-    gGfxState.matrixStack.matrix = result;
-}
-void gfx_rotate (float32_t r) {
-    mat2d_t result = gGfxState.matrixStack.matrix;
-    mat2DRotate(&result, &gGfxState.matrixStack.matrix, r);
-    gGfxState.matrixStack.matrix = result;
-}
-void gfx_load_identity (void) {
-    mat2dIdent(&gGfxState.matrixStack.matrix);
-}
-void gfx_vertex2(float32_t x, float32_t y, uint32_t color) {
-    DBG_ASSERT(gGfxState.pipelineID == PIPELINE_LINE, "Need to set pipeline to PIPELINE_LINE to draw lines.");
-    if (gGfxState.points.count >= kMaxPoints) return;
-    vec2_t output = { 0.0f, 0.0f };
-    vec2_t input = { x, y };
-    mat2DVec2Mul(&output, &gGfxState.matrixStack.matrix, &input);
-    PointVertex vertex = { { output.x, output.y }, color };
-    gGfxState.points.pBuffer[gGfxState.points.count++] = vertex;
-}
-void gfx_line2(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color0, uint32_t color1) {
-    gfx_vertex2(x0, y0, color0);
-    gfx_vertex2(x1, y1, color1);
-}
-void gfx_line(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color) {
-    gfx_line2(x0, y0, x1, y1, color, color);
-}
-bool32_t gfx_set_pipeline (uint32_t pipeline) {
-    if (pipeline >= 0 && pipeline < kMaxPipelines && gGfxState.pipelineID != pipeline) {
-        if (gGfxState.currentPipeline) {
-            gGfxState.framebufferLoadAction = MTLLoadActionDontCare;
-            gfx_flush();
-            _gfx_force_end_no_present();
-            gfx_begin();
-            gGfxState.framebufferLoadAction = MTLLoadActionClear;
-        }
-        gGfxState.pipelineID = pipeline;
-        gGfxState.currentPipeline = gGfxState.pipelines[pipeline];
-        return UT_TRUE;
-    }
-    return UT_FALSE;
-}
 float32_t gfx_get_pixel_ratio (void) {
 #if defined(TARGET_MACOS)
     return (float32_t)[NSScreen mainScreen].backingScaleFactor;
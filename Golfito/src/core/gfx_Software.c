@@ -0,0 +1,563 @@
+#include "gfx.h"
+#include "gfx_batch.h"
+#include "../config/config_gfx.h"
+#include "math.h"
+#include "utils.h"
+#include "assert.h"
+#include "memory.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+#define SUBPIXEL_BITS 4
+#define SUBPIXEL_ONE (1 << SUBPIXEL_BITS)
+#define TILE_SIZE 64
+#define MAX_WORKERS 64
+
+typedef struct {
+    byte_t* pPixels;
+    uint32_t width;
+    uint32_t height;
+} SoftwareTexture;
+
+typedef struct {
+    byte_t* pPixels;
+    uint32_t width;
+    uint32_t height;
+} SoftwareFramebuffer;
+
+typedef struct {
+    int32_t minX, minY;
+    int32_t maxX, maxY;
+} SoftwareRect;
+
+typedef struct {
+    uint16_t minTileX, minTileY;
+    uint16_t maxTileX, maxTileY;
+} SoftwareTileSpan;
+
+/* Primitives are binned per tile in submission order, so blending stays ordered inside each tile. */
+typedef struct {
+    uint32_t* pOffsets;
+    uint32_t* pItems;
+    SoftwareTileSpan* pSpans;
+    const SoftwareTexture** ppTextures;
+    uint32_t itemCapacity;
+    uint32_t tileCapacity;
+    uint32_t tilesX;
+    uint32_t tilesY;
+    uint32_t primitiveCount;
+} SoftwareTileBins;
+
+typedef struct {
+    pthread_t threads[MAX_WORKERS];
+    pthread_mutex_t mutex;
+    pthread_cond_t wakeCond;
+    pthread_cond_t doneCond;
+    uint32_t threadCount;
+    uint32_t generation;
+    uint32_t activeCount;
+    uint32_t nextTile;
+    bool32_t shutdown;
+} SoftwareWorkerPool;
+
+typedef struct {
+    vec2_t viewportSize;
+    SoftwareFramebuffer framebuffer;
+    SoftwareTileBins tileBins;
+    SoftwareWorkerPool workers;
+    struct { byte_t r, g, b, a; } clearColor;
+    uint64_t memFrameIdx;
+} GfxStateSoftware;
+
+static GfxStateSoftware gGfxState = { 0 };
+
+/* Colors are packed as 0xRRGGBBAA (see GET_COLOR_RGBA_U32) while textures and
+   the framebuffer store RGBA8 bytes, the same layout the GPU backends upload. */
+#define _COLOR_R(color) (((color) >> 24) & 0xFF)
+#define _COLOR_G(color) (((color) >> 16) & 0xFF)
+#define _COLOR_B(color) (((color) >> 8) & 0xFF)
+#define _COLOR_A(color) ((color) & 0xFF)
+
+static inline uint32_t _div255(uint32_t value) {
+    value += 128;
+    return (value + (value >> 8)) >> 8;
+}
+
+/* SRC_ALPHA / INV_SRC_ALPHA for both color and alpha, same as the Metal pipelines. */
+static inline void _blend_pixel(byte_t* pDst, uint32_t r, uint32_t g, uint32_t b, uint32_t a) {
+    if (a == 0) return;
+    if (a == 255) {
+        pDst[0] = (byte_t)r;
+        pDst[1] = (byte_t)g;
+        pDst[2] = (byte_t)b;
+        pDst[3] = 255;
+        return;
+    }
+    uint32_t invA = 255 - a;
+    pDst[0] = (byte_t)_div255(r * a + pDst[0] * invA);
+    pDst[1] = (byte_t)_div255(g * a + pDst[1] * invA);
+    pDst[2] = (byte_t)_div255(b * a + pDst[2] * invA);
+    pDst[3] = (byte_t)_div255(a * a + pDst[3] * invA);
+}
+
+static void _gfx_resize_framebuffer(uint32_t width, uint32_t height) {
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    if (pFramebuffer->width == width && pFramebuffer->height == height && pFramebuffer->pPixels != NULL) return;
+    mem_free(pFramebuffer->pPixels);
+    mem_push_tag(MEM_TAG_GFX);
+    pFramebuffer->pPixels = (byte_t*)mem_alloc((size_t)width * height * 4);
+    mem_pop_tag();
+    DBG_ASSERT(pFramebuffer->pPixels != NULL, "Failed to allocate software framebuffer of %ux%u", width, height);
+    pFramebuffer->width = width;
+    pFramebuffer->height = height;
+}
+
+static inline int64_t _edge(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t px, int32_t py) {
+    return (int64_t)(bx - ax) * (py - ay) - (int64_t)(by - ay) * (px - ax);
+}
+
+/* Top-left fill convention so the shared diagonal of a quad is only blended once. */
+static inline bool32_t _is_top_left(int32_t ax, int32_t ay, int32_t bx, int32_t by) {
+    return (by < ay) || (by == ay && bx > ax);
+}
+
+static void _rasterize_triangle(const TextureColorVertex* pV0, const TextureColorVertex* pV1, const TextureColorVertex* pV2, const SoftwareTexture* pTexture, const SoftwareRect* pClip) {
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    /* Snap to a fixed sub-pixel grid so edge functions are exact and adjacent triangles agree. */
+    int32_t x0 = (int32_t)lrintf(pV0->position.x * SUBPIXEL_ONE), y0 = (int32_t)lrintf(pV0->position.y * SUBPIXEL_ONE);
+    int32_t x1 = (int32_t)lrintf(pV1->position.x * SUBPIXEL_ONE), y1 = (int32_t)lrintf(pV1->position.y * SUBPIXEL_ONE);
+    int32_t x2 = (int32_t)lrintf(pV2->position.x * SUBPIXEL_ONE), y2 = (int32_t)lrintf(pV2->position.y * SUBPIXEL_ONE);
+    int64_t area = _edge(x0, y0, x1, y1, x2, y2);
+    if (area == 0) return;
+    if (area < 0) {
+        const TextureColorVertex* pTempVertex = pV1;
+        int32_t tempX = x1, tempY = y1;
+        pV1 = pV2; x1 = x2; y1 = y2;
+        pV2 = pTempVertex; x2 = tempX; y2 = tempY;
+        area = -area;
+    }
+
+    int32_t minX = UT_MIN(x0, UT_MIN(x1, x2)) >> SUBPIXEL_BITS;
+    int32_t minY = UT_MIN(y0, UT_MIN(y1, y2)) >> SUBPIXEL_BITS;
+    int32_t maxX = (UT_MAX(x0, UT_MAX(x1, x2)) + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS;
+    int32_t maxY = (UT_MAX(y0, UT_MAX(y1, y2)) + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS;
+    minX = UT_CLAMP(minX, pClip->minX, pClip->maxX);
+    minY = UT_CLAMP(minY, pClip->minY, pClip->maxY);
+    maxX = UT_CLAMP(maxX, pClip->minX, pClip->maxX);
+    maxY = UT_CLAMP(maxY, pClip->minY, pClip->maxY);
+    if (minX >= maxX || minY >= maxY) return;
+
+    /* Edge function i is opposite to vertex i, so it is also its barycentric weight. */
+    bool32_t topLeft0 = _is_top_left(x1, y1, x2, y2);
+    bool32_t topLeft1 = _is_top_left(x2, y2, x0, y0);
+    bool32_t topLeft2 = _is_top_left(x0, y0, x1, y1);
+    int64_t stepX0 = (int64_t)(y1 - y2) * SUBPIXEL_ONE, stepY0 = (int64_t)(x2 - x1) * SUBPIXEL_ONE;
+    int64_t stepX1 = (int64_t)(y2 - y0) * SUBPIXEL_ONE, stepY1 = (int64_t)(x0 - x2) * SUBPIXEL_ONE;
+    int64_t stepX2 = (int64_t)(y0 - y1) * SUBPIXEL_ONE, stepY2 = (int64_t)(x1 - x0) * SUBPIXEL_ONE;
+    int32_t startX = (minX << SUBPIXEL_BITS) + SUBPIXEL_ONE / 2;
+    int32_t startY = (minY << SUBPIXEL_BITS) + SUBPIXEL_ONE / 2;
+    int64_t row0 = _edge(x1, y1, x2, y2, startX, startY);
+    int64_t row1 = _edge(x2, y2, x0, y0, startX, startY);
+    int64_t row2 = _edge(x0, y0, x1, y1, startX, startY);
+    float32_t invArea = 1.0f / (float32_t)area;
+
+    bool32_t flatColor = (pV0->color == pV1->color && pV1->color == pV2->color);
+    uint32_t flatR = _COLOR_R(pV0->color), flatG = _COLOR_G(pV0->color), flatB = _COLOR_B(pV0->color), flatA = _COLOR_A(pV0->color);
+    float32_t texWidth = pTexture ? (float32_t)pTexture->width : 0.0f;
+    float32_t texHeight = pTexture ? (float32_t)pTexture->height : 0.0f;
+    size_t pitch = (size_t)pFramebuffer->width * 4;
+
+    for (int32_t y = minY; y < maxY; ++y) {
+        int64_t w0 = row0, w1 = row1, w2 = row2;
+        byte_t* pDst = pFramebuffer->pPixels + (size_t)y * pitch + (size_t)minX * 4;
+        for (int32_t x = minX; x < maxX; ++x, pDst += 4, w0 += stepX0, w1 += stepX1, w2 += stepX2) {
+            if ((w0 | w1 | w2) < 0) continue;
+            if ((w0 == 0 && !topLeft0) || (w1 == 0 && !topLeft1) || (w2 == 0 && !topLeft2)) continue;
+            float32_t b0 = (float32_t)w0 * invArea, b1 = (float32_t)w1 * invArea, b2 = (float32_t)w2 * invArea;
+            uint32_t r = flatR, g = flatG, b = flatB, a = flatA;
+            if (!flatColor) {
+                r = (uint32_t)(b0 * _COLOR_R(pV0->color) + b1 * _COLOR_R(pV1->color) + b2 * _COLOR_R(pV2->color) + 0.5f);
+                g = (uint32_t)(b0 * _COLOR_G(pV0->color) + b1 * _COLOR_G(pV1->color) + b2 * _COLOR_G(pV2->color) + 0.5f);
+                b = (uint32_t)(b0 * _COLOR_B(pV0->color) + b1 * _COLOR_B(pV1->color) + b2 * _COLOR_B(pV2->color) + 0.5f);
+                a = (uint32_t)(b0 * _COLOR_A(pV0->color) + b1 * _COLOR_A(pV1->color) + b2 * _COLOR_A(pV2->color) + 0.5f);
+            }
+            if (pTexture) {
+                float32_t u = b0 * pV0->texCoord.x + b1 * pV1->texCoord.x + b2 * pV2->texCoord.x;
+                float32_t v = b0 * pV0->texCoord.y + b1 * pV1->texCoord.y + b2 * pV2->texCoord.y;
+                int32_t tx = (int32_t)UT_CLAMP(u * texWidth, 0.0f, texWidth - 1.0f);
+                int32_t ty = (int32_t)UT_CLAMP(v * texHeight, 0.0f, texHeight - 1.0f);
+                const byte_t* pTexel = pTexture->pPixels + ((size_t)ty * pTexture->width + (size_t)tx) * 4;
+                if (pTexel[3] == 0) continue;
+                r = _div255(r * pTexel[0]);
+                g = _div255(g * pTexel[1]);
+                b = _div255(b * pTexel[2]);
+                a = _div255(a * pTexel[3]);
+            }
+            _blend_pixel(pDst, r, g, b, a);
+        }
+        row0 += stepY0;
+        row1 += stepY1;
+        row2 += stepY2;
+    }
+}
+
+static bool32_t _compute_tile_span(float32_t minX, float32_t minY, float32_t maxX, float32_t maxY, SoftwareTileSpan* pSpan) {
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    if (maxX < 0.0f || maxY < 0.0f || minX >= (float32_t)pFramebuffer->width || minY >= (float32_t)pFramebuffer->height) return UT_FALSE;
+    int32_t x0 = (int32_t)UT_MAX(minX, 0.0f) / TILE_SIZE;
+    int32_t y0 = (int32_t)UT_MAX(minY, 0.0f) / TILE_SIZE;
+    int32_t x1 = (int32_t)UT_MIN(maxX, (float32_t)(pFramebuffer->width - 1)) / TILE_SIZE;
+    int32_t y1 = (int32_t)UT_MIN(maxY, (float32_t)(pFramebuffer->height - 1)) / TILE_SIZE;
+    pSpan->minTileX = (uint16_t)x0;
+    pSpan->minTileY = (uint16_t)y0;
+    pSpan->maxTileX = (uint16_t)x1;
+    pSpan->maxTileY = (uint16_t)y1;
+    return UT_TRUE;
+}
+
+static void _reserve_tile_bins(uint32_t tileCount) {
+    SoftwareTileBins* pBins = &gGfxState.tileBins;
+    if (tileCount + 1 > pBins->tileCapacity) {
+        mem_free(pBins->pOffsets);
+        mem_push_tag(MEM_TAG_GFX);
+        pBins->pOffsets = (uint32_t*)mem_alloc(sizeof(uint32_t) * (tileCount + 1));
+        mem_pop_tag();
+        DBG_ASSERT(pBins->pOffsets != NULL, "Failed to allocate tile bins");
+        pBins->tileCapacity = tileCount + 1;
+    }
+    if (pBins->pSpans == NULL) {
+        uint32_t maxPrimitives = GFX_MAX_INDICES / 3;
+        mem_push_tag(MEM_TAG_GFX);
+        pBins->pSpans = (SoftwareTileSpan*)mem_alloc(sizeof(SoftwareTileSpan) * maxPrimitives);
+        pBins->ppTextures = (const SoftwareTexture**)mem_alloc(sizeof(SoftwareTexture*) * maxPrimitives);
+        mem_pop_tag();
+        DBG_ASSERT(pBins->pSpans != NULL && pBins->ppTextures != NULL, "Failed to allocate tile spans");
+    }
+}
+
+static void _reserve_tile_items(uint32_t itemCount) {
+    SoftwareTileBins* pBins = &gGfxState.tileBins;
+    if (itemCount <= pBins->itemCapacity) return;
+    uint32_t capacity = UT_MAX(itemCount, pBins->itemCapacity * 2);
+    mem_free(pBins->pItems);
+    mem_push_tag(MEM_TAG_GFX);
+    pBins->pItems = (uint32_t*)mem_alloc(sizeof(uint32_t) * capacity);
+    mem_pop_tag();
+    DBG_ASSERT(pBins->pItems != NULL, "Failed to allocate %u tile bin items", capacity);
+    pBins->itemCapacity = capacity;
+}
+
+/* Two passes: count primitives per tile, prefix sum, then scatter primitive indices. */
+static void _bin_primitives(void) {
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    SoftwareTileBins* pBins = &gGfxState.tileBins;
+    uint32_t tilesX = (pFramebuffer->width + TILE_SIZE - 1) / TILE_SIZE;
+    uint32_t tilesY = (pFramebuffer->height + TILE_SIZE - 1) / TILE_SIZE;
+    uint32_t tileCount = tilesX * tilesY;
+    uint32_t primitiveCount = gGfxBatch.vertices.count / 4 * 2;
+
+    _reserve_tile_bins(tileCount);
+    pBins->tilesX = tilesX;
+    pBins->tilesY = tilesY;
+    memset(pBins->pOffsets, 0, sizeof(uint32_t) * (tileCount + 1));
+
+    const TextureColorVertex* pVertices = gGfxBatch.vertices.pBuffer;
+    const uint16_t* pIndices = gGfxBatch.pQuadIndices;
+    for (uint32_t batchIndex = 0; batchIndex < gGfxBatch.batchBuffer.count; ++batchIndex) {
+        const DrawBatch* pBatch = &gGfxBatch.batchBuffer.pBuffer[batchIndex];
+        for (uint32_t index = 0; index + 2 < pBatch->count; index += 3) {
+            const uint16_t* pTriangle = &pIndices[pBatch->offset + index];
+            const vec2_t* pP0 = &pVertices[pTriangle[0]].position;
+            const vec2_t* pP1 = &pVertices[pTriangle[1]].position;
+            const vec2_t* pP2 = &pVertices[pTriangle[2]].position;
+            uint32_t primitive = (pBatch->offset + index) / 3;
+            float32_t minX = fminf(pP0->x, fminf(pP1->x, pP2->x));
+            float32_t minY = fminf(pP0->y, fminf(pP1->y, pP2->y));
+            float32_t maxX = fmaxf(pP0->x, fmaxf(pP1->x, pP2->x));
+            float32_t maxY = fmaxf(pP0->y, fmaxf(pP1->y, pP2->y));
+            SoftwareTileSpan* pSpan = &pBins->pSpans[primitive];
+            pBins->ppTextures[primitive] = (const SoftwareTexture*)pBatch->texture;
+            if (!_compute_tile_span(minX, minY, maxX, maxY, pSpan)) {
+                pSpan->minTileX = 1;
+                pSpan->maxTileX = 0;
+            }
+        }
+    }
+    pBins->primitiveCount = primitiveCount;
+
+    for (uint32_t primitive = 0; primitive < primitiveCount; ++primitive) {
+        const SoftwareTileSpan* pSpan = &pBins->pSpans[primitive];
+        for (uint32_t ty = pSpan->minTileY; ty <= pSpan->maxTileY && pSpan->minTileX <= pSpan->maxTileX; ++ty) {
+            for (uint32_t tx = pSpan->minTileX; tx <= pSpan->maxTileX; ++tx) {
+                pBins->pOffsets[ty * tilesX + tx + 1] += 1;
+            }
+        }
+    }
+    for (uint32_t tile = 0; tile < tileCount; ++tile) {
+        pBins->pOffsets[tile + 1] += pBins->pOffsets[tile];
+    }
+    _reserve_tile_items(pBins->pOffsets[tileCount]);
+    for (uint32_t primitive = 0; primitive < primitiveCount; ++primitive) {
+        const SoftwareTileSpan* pSpan = &pBins->pSpans[primitive];
+        for (uint32_t ty = pSpan->minTileY; ty <= pSpan->maxTileY && pSpan->minTileX <= pSpan->maxTileX; ++ty) {
+            for (uint32_t tx = pSpan->minTileX; tx <= pSpan->maxTileX; ++tx) {
+                pBins->pItems[pBins->pOffsets[ty * tilesX + tx]++] = primitive;
+            }
+        }
+    }
+    /* The scatter pass advanced every offset to the start of the next tile, shift them back. */
+    for (uint32_t tile = tileCount; tile > 0; --tile) {
+        pBins->pOffsets[tile] = pBins->pOffsets[tile - 1];
+    }
+    pBins->pOffsets[0] = 0;
+}
+
+static void _rasterize_tile(uint32_t tile) {
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    SoftwareTileBins* pBins = &gGfxState.tileBins;
+    uint32_t tileX = tile % pBins->tilesX;
+    uint32_t tileY = tile / pBins->tilesX;
+    SoftwareRect clip;
+    clip.minX = (int32_t)(tileX * TILE_SIZE);
+    clip.minY = (int32_t)(tileY * TILE_SIZE);
+    clip.maxX = (int32_t)UT_MIN((tileX + 1) * TILE_SIZE, pFramebuffer->width);
+    clip.maxY = (int32_t)UT_MIN((tileY + 1) * TILE_SIZE, pFramebuffer->height);
+    const uint32_t* pItems = &pBins->pItems[pBins->pOffsets[tile]];
+    uint32_t itemCount = pBins->pOffsets[tile + 1] - pBins->pOffsets[tile];
+
+    const TextureColorVertex* pVertices = gGfxBatch.vertices.pBuffer;
+    const uint16_t* pIndices = gGfxBatch.pQuadIndices;
+    for (uint32_t index = 0; index < itemCount; ++index) {
+        uint32_t primitive = pItems[index];
+        const uint16_t* pTriangle = &pIndices[primitive * 3];
+        _rasterize_triangle(&pVertices[pTriangle[0]], &pVertices[pTriangle[1]], &pVertices[pTriangle[2]], pBins->ppTextures[primitive], &clip);
+    }
+}
+
+static void _rasterize_tiles(void) {
+    SoftwareWorkerPool* pWorkers = &gGfxState.workers;
+    uint32_t tileCount = gGfxState.tileBins.tilesX * gGfxState.tileBins.tilesY;
+    for (;;) {
+        uint32_t tile = __atomic_fetch_add(&pWorkers->nextTile, 1, __ATOMIC_RELAXED);
+        if (tile >= tileCount) break;
+        _rasterize_tile(tile);
+    }
+}
+
+static void* _worker_main(void* pArg) {
+    SoftwareWorkerPool* pWorkers = &gGfxState.workers;
+    uint32_t generation = 0;
+    UT_UNUSED(pArg);
+    for (;;) {
+        pthread_mutex_lock(&pWorkers->mutex);
+        while (pWorkers->generation == generation && !pWorkers->shutdown) {
+            pthread_cond_wait(&pWorkers->wakeCond, &pWorkers->mutex);
+        }
+        if (pWorkers->shutdown) {
+            pthread_mutex_unlock(&pWorkers->mutex);
+            break;
+        }
+        generation = pWorkers->generation;
+        pthread_mutex_unlock(&pWorkers->mutex);
+
+        _rasterize_tiles();
+
+        pthread_mutex_lock(&pWorkers->mutex);
+        if (--pWorkers->activeCount == 0) {
+            pthread_cond_signal(&pWorkers->doneCond);
+        }
+        pthread_mutex_unlock(&pWorkers->mutex);
+    }
+    return NULL;
+}
+
+/* The calling thread rasterizes tiles too, so a pool of N threads uses N + 1 cores. */
+static void _dispatch_tiles(void) {
+    SoftwareWorkerPool* pWorkers = &gGfxState.workers;
+    if (pWorkers->threadCount == 0) {
+        pWorkers->nextTile = 0;
+        _rasterize_tiles();
+        return;
+    }
+    pthread_mutex_lock(&pWorkers->mutex);
+    __atomic_store_n(&pWorkers->nextTile, 0, __ATOMIC_RELAXED);
+    pWorkers->activeCount = pWorkers->threadCount;
+    pWorkers->generation += 1;
+    pthread_cond_broadcast(&pWorkers->wakeCond);
+    pthread_mutex_unlock(&pWorkers->mutex);
+
+    _rasterize_tiles();
+
+    pthread_mutex_lock(&pWorkers->mutex);
+    while (pWorkers->activeCount > 0) {
+        pthread_cond_wait(&pWorkers->doneCond, &pWorkers->mutex);
+    }
+    pthread_mutex_unlock(&pWorkers->mutex);
+}
+
+static void _start_workers(void) {
+    SoftwareWorkerPool* pWorkers = &gGfxState.workers;
+    long cpuCount = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* pThreadCount = getenv("GOLFITO_GFX_THREADS");
+    if (pThreadCount != NULL) cpuCount = strtol(pThreadCount, NULL, 10);
+    if (cpuCount < 1) cpuCount = 1;
+    pWorkers->threadCount = (uint32_t)UT_MIN(cpuCount - 1, MAX_WORKERS);
+    pWorkers->generation = 0;
+    pWorkers->activeCount = 0;
+    pWorkers->shutdown = UT_FALSE;
+    pthread_mutex_init(&pWorkers->mutex, NULL);
+    pthread_cond_init(&pWorkers->wakeCond, NULL);
+    pthread_cond_init(&pWorkers->doneCond, NULL);
+    for (uint32_t index = 0; index < pWorkers->threadCount; ++index) {
+        int result = pthread_create(&pWorkers->threads[index], NULL, &_worker_main, NULL);
+        DBG_ASSERT(result == 0, "Failed to create rasterizer worker %u", index);
+        UT_UNUSED(result);
+    }
+}
+
+static void _stop_workers(void) {
+    SoftwareWorkerPool* pWorkers = &gGfxState.workers;
+    pthread_mutex_lock(&pWorkers->mutex);
+    pWorkers->shutdown = UT_TRUE;
+    pthread_cond_broadcast(&pWorkers->wakeCond);
+    pthread_mutex_unlock(&pWorkers->mutex);
+    for (uint32_t index = 0; index < pWorkers->threadCount; ++index) {
+        pthread_join(pWorkers->threads[index], NULL);
+    }
+    pthread_cond_destroy(&pWorkers->doneCond);
+    pthread_cond_destroy(&pWorkers->wakeCond);
+    pthread_mutex_destroy(&pWorkers->mutex);
+}
+
+void _gfx_software_initialize(float32_t width, float32_t height) {
+    gGfxState.viewportSize.x = width;
+    gGfxState.viewportSize.y = height;
+    _gfx_resize_framebuffer((uint32_t)width, (uint32_t)height);
+}
+
+void _gfx_software_get_framebuffer(const void** ppPixels, uint32_t* pWidth, uint32_t* pHeight) {
+    *ppPixels = gGfxState.framebuffer.pPixels;
+    *pWidth = gGfxState.framebuffer.width;
+    *pHeight = gGfxState.framebuffer.height;
+}
+
+void gfx_initialize(void) {
+    if (gGfxState.viewportSize.x <= 0.0f || gGfxState.viewportSize.y <= 0.0f) {
+        _gfx_software_initialize((float32_t)GFX_DISPLAY_WIDTH, (float32_t)GFX_DISPLAY_HEIGHT);
+    }
+    _gfx_batch_initialize();
+    _start_workers();
+}
+
+void gfx_shutdown(void) {
+    _stop_workers();
+    mem_free(gGfxState.tileBins.pOffsets);
+    mem_free(gGfxState.tileBins.pItems);
+    mem_free(gGfxState.tileBins.pSpans);
+    mem_free(gGfxState.tileBins.ppTextures);
+    _gfx_batch_shutdown();
+    mem_free(gGfxState.framebuffer.pPixels);
+    memset(&gGfxState, 0, sizeof(gGfxState));
+}
+
+void gfx_begin(void) {
+    gGfxState.memFrameIdx = mem_frame_begin();
+    _gfx_resize_framebuffer((uint32_t)gGfxState.viewportSize.x, (uint32_t)gGfxState.viewportSize.y);
+    SoftwareFramebuffer* pFramebuffer = &gGfxState.framebuffer;
+    uint32_t clear = 0;
+    memcpy(&clear, &gGfxState.clearColor, sizeof(clear));
+    uint32_t* pPixels = (uint32_t*)pFramebuffer->pPixels;
+    size_t pixelCount = (size_t)pFramebuffer->width * pFramebuffer->height;
+    for (size_t index = 0; index < pixelCount; ++index) {
+        pPixels[index] = clear;
+    }
+}
+
+void gfx_end(void) {
+    gfx_flush();
+    _gfx_batch_end_frame();
+    /* Tiles are rasterized before gfx_flush returns, so the frame is consumed already. */
+    mem_frame_retire(gGfxState.memFrameIdx);
+}
+
+void gfx_flush(void) {
+    _gfx_batch_sort();
+    GFX_STATS_ADD(flushes, 1);
+    GFX_STATS_ADD(batches, gGfxBatch.batchBuffer.count);
+    /* No GPU here, every batch stands in for the draw call a GPU backend would issue. */
+    GFX_STATS_ADD(drawCalls, gGfxBatch.batchBuffer.count);
+    if (gGfxBatch.vertices.count > 0) {
+        _bin_primitives();
+        _dispatch_tiles();
+    }
+
+    _gfx_batch_reset();
+}
+
+void gfx_resize(float32_t width, float32_t height) {
+    gGfxState.viewportSize.x = width;
+    gGfxState.viewportSize.y = height;
+}
+
+void gfx_set_clear_color(float32_t r, float32_t g, float32_t b, float32_t a) {
+    gGfxState.clearColor.r = (byte_t)(UT_CLAMP(r, 0.0f, 1.0f) * 255.0f + 0.5f);
+    gGfxState.clearColor.g = (byte_t)(UT_CLAMP(g, 0.0f, 1.0f) * 255.0f + 0.5f);
+    gGfxState.clearColor.b = (byte_t)(UT_CLAMP(b, 0.0f, 1.0f) * 255.0f + 0.5f);
+    gGfxState.clearColor.a = (byte_t)(UT_CLAMP(a, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+TextureID gfx_create_texture(uint32_t width, uint32_t height, const void* pPixels) {
+    mem_push_tag(MEM_TAG_TEXTURES);
+    SoftwareTexture* pTexture = (SoftwareTexture*)mem_alloc(sizeof(SoftwareTexture) + (size_t)width * height * 4);
+    mem_pop_tag();
+    if (pTexture == NULL) return INVALID_TEXTURE_ID;
+    pTexture->pPixels = (byte_t*)(pTexture + 1);
+    pTexture->width = width;
+    pTexture->height = height;
+    memcpy(pTexture->pPixels, pPixels, (size_t)width * height * 4);
+    return (TextureID)pTexture;
+}
+
+byte_t* _gfx_load_image(const char* pImagePath, uint32_t* pWidth, uint32_t* pHeight) {
+    int x, y, c;
+    uint8_t* pPixels = stbi_load(pImagePath, &x, &y, &c, 4);
+    if (pPixels == NULL) {
+        fprintf(stderr, "Failed to load image %s\n", pImagePath);
+        return NULL;
+    }
+    *pWidth = (uint32_t)x;
+    *pHeight = (uint32_t)y;
+    return pPixels;
+}
+
+void _gfx_free_image(byte_t* pPixels) {
+    stbi_image_free(pPixels);
+}
+
+TextureID gfx_load_texture(const char* pTexturePath) {
+    uint32_t width = 0, height = 0;
+    byte_t* pPixels = _gfx_load_image(pTexturePath, &width, &height);
+    if (pPixels == NULL) return INVALID_TEXTURE_ID;
+    TextureID texture = gfx_create_texture(width, height, pPixels);
+    _gfx_free_image(pPixels);
+    return texture;
+}
+
+vec2_t gfx_get_texture_size(TextureID texture) {
+    const SoftwareTexture* pTexture = (const SoftwareTexture*)texture;
+    vec2_t size = { (float32_t)pTexture->width, (float32_t)pTexture->height };
+    return size;
+}
+
+vec2_t gfx_get_view_size(void) {
+    return gGfxState.viewportSize;
+}
+
+float32_t gfx_get_pixel_ratio(void) {
+    return 1.0f;
+}
@@ -0,0 +1,319 @@
+#include "gfx_atlas.h"
+#include "utils.h"
+#include "assert.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#define ATLAS_CACHE_MAGIC 0x4C544147 /* "GATL" */
+#define ATLAS_CACHE_VERSION 1
+
+/* Implemented by each gfx backend next to gfx_load_texture, RGBA8 pixels. */
+extern byte_t* _gfx_load_image(const char* pImagePath, uint32_t* pWidth, uint32_t* pHeight);
+extern void _gfx_free_image(byte_t* pPixels);
+
+typedef struct {
+    uint16_t x, y;
+    uint16_t width;
+} SkylineNode;
+
+/* Top edge of the packed area as a list of horizontal segments covering the page width. */
+typedef struct {
+    SkylineNode nodes[GFX_ATLAS_PAGE_SIZE + 1];
+    uint32_t count;
+} Skyline;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pageSize;
+    uint32_t padding;
+    uint32_t imageCount;
+    uint32_t pageCount;
+} AtlasCacheHeader;
+
+typedef struct {
+    uint32_t nameHash;
+    uint16_t width, height;
+    uint16_t page, x, y;
+    uint16_t reserved;
+} AtlasCacheEntry;
+
+static uint32_t _hash_name(const char* pName) {
+    uint32_t hash = 2166136261u;
+    while (*pName != '\0') {
+        hash = (hash ^ (uint8_t)*pName++) * 16777619u;
+    }
+    return hash;
+}
+
+void gfx_atlas_initialize(GfxAtlas* pAtlas) {
+    memset(pAtlas, 0, sizeof(GfxAtlas));
+}
+
+uint32_t gfx_atlas_add_pixels(GfxAtlas* pAtlas, const char* pName, uint32_t width, uint32_t height, const void* pPixels) {
+    DBG_ASSERT(!pAtlas->isBuilt, "Can't add images to an atlas that is already built");
+    DBG_ASSERT(pAtlas->imageCount < GFX_ATLAS_MAX_IMAGES, "Exceeded the maximum of %u atlas images", GFX_ATLAS_MAX_IMAGES);
+    if (pAtlas->imageCount >= GFX_ATLAS_MAX_IMAGES || pPixels == NULL) return GFX_ATLAS_INVALID_IMAGE;
+    GfxAtlasImage* pImage = &pAtlas->images[pAtlas->imageCount];
+    pImage->pPixels = (byte_t*)pPixels;
+    pImage->nameHash = _hash_name(pName);
+    pImage->width = (uint16_t)width;
+    pImage->height = (uint16_t)height;
+    pImage->isLoaded = UT_FALSE;
+    return pAtlas->imageCount++;
+}
+
+uint32_t gfx_atlas_add_image(GfxAtlas* pAtlas, const char* pImagePath) {
+    uint32_t width = 0, height = 0;
+    byte_t* pPixels = _gfx_load_image(pImagePath, &width, &height);
+    if (pPixels == NULL) return GFX_ATLAS_INVALID_IMAGE;
+    uint32_t image = gfx_atlas_add_pixels(pAtlas, pImagePath, width, height, pPixels);
+    if (image == GFX_ATLAS_INVALID_IMAGE) {
+        _gfx_free_image(pPixels);
+        return GFX_ATLAS_INVALID_IMAGE;
+    }
+    pAtlas->images[image].isLoaded = UT_TRUE;
+    return image;
+}
+
+/* Finds the lowest y a width x height rect can sit at when its left edge starts at node index. */
+static bool32_t _skyline_fit(const Skyline* pSkyline, uint32_t index, uint32_t width, uint32_t height, uint32_t* pY) {
+    uint32_t x = pSkyline->nodes[index].x;
+    if (x + width > GFX_ATLAS_PAGE_SIZE) return UT_FALSE;
+    uint32_t widthLeft = width;
+    uint32_t y = 0;
+    for (;;) {
+        const SkylineNode* pNode = &pSkyline->nodes[index];
+        y = UT_MAX(y, pNode->y);
+        if (y + height > GFX_ATLAS_PAGE_SIZE) return UT_FALSE;
+        if (pNode->width >= widthLeft) break;
+        widthLeft -= pNode->width;
+        ++index;
+    }
+    *pY = y;
+    return UT_TRUE;
+}
+
+static void _skyline_insert(Skyline* pSkyline, uint32_t index, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    SkylineNode* pNodes = pSkyline->nodes;
+    memmove(&pNodes[index + 1], &pNodes[index], sizeof(SkylineNode) * (pSkyline->count - index));
+    pNodes[index].x = (uint16_t)x;
+    pNodes[index].y = (uint16_t)(y + height);
+    pNodes[index].width = (uint16_t)width;
+    pSkyline->count += 1;
+    /* Cut the segments now hidden under the new one. */
+    for (uint32_t next = index + 1; next < pSkyline->count;) {
+        uint32_t right = pNodes[next - 1].x + pNodes[next - 1].width;
+        if (pNodes[next].x >= right) break;
+        uint32_t overlap = right - pNodes[next].x;
+        if (pNodes[next].width > overlap) {
+            pNodes[next].x += (uint16_t)overlap;
+            pNodes[next].width -= (uint16_t)overlap;
+            break;
+        }
+        memmove(&pNodes[next], &pNodes[next + 1], sizeof(SkylineNode) * (pSkyline->count - next - 1));
+        pSkyline->count -= 1;
+    }
+    for (uint32_t node = 0; node + 1 < pSkyline->count;) {
+        if (pNodes[node].y == pNodes[node + 1].y) {
+            pNodes[node].width += pNodes[node + 1].width;
+            memmove(&pNodes[node + 1], &pNodes[node + 2], sizeof(SkylineNode) * (pSkyline->count - node - 2));
+            pSkyline->count -= 1;
+        } else {
+            ++node;
+        }
+    }
+}
+
+/* Bottom-left rule: the position with the lowest top edge wins, then the narrowest segment. */
+static bool32_t _skyline_pack(Skyline* pSkyline, uint32_t width, uint32_t height, uint32_t* pX, uint32_t* pY) {
+    uint32_t bestIndex = (uint32_t)-1;
+    uint32_t bestTop = (uint32_t)-1;
+    uint32_t bestWidth = (uint32_t)-1;
+    uint32_t bestY = 0;
+    for (uint32_t index = 0; index < pSkyline->count; ++index) {
+        uint32_t y = 0;
+        if (!_skyline_fit(pSkyline, index, width, height, &y)) continue;
+        uint32_t top = y + height;
+        if (top < bestTop || (top == bestTop && pSkyline->nodes[index].width < bestWidth)) {
+            bestIndex = index;
+            bestTop = top;
+            bestWidth = pSkyline->nodes[index].width;
+            bestY = y;
+        }
+    }
+    if (bestIndex == (uint32_t)-1) return UT_FALSE;
+    *pX = pSkyline->nodes[bestIndex].x;
+    *pY = bestY;
+    _skyline_insert(pSkyline, bestIndex, *pX, bestY, width, height);
+    return UT_TRUE;
+}
+
+static int _compare_pack_keys(const void* pA, const void* pB) {
+    uint64_t a = *(const uint64_t*)pA;
+    uint64_t b = *(const uint64_t*)pB;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+/* Tallest images first, which keeps the skyline flat. Ties keep add order so the layout is deterministic. */
+static bool32_t _pack_images(GfxAtlas* pAtlas) {
+    uint64_t order[GFX_ATLAS_MAX_IMAGES];
+    for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+        const GfxAtlasImage* pImage = &pAtlas->images[index];
+        order[index] = ((uint64_t)(0xFFFF - pImage->height) << 32) | ((uint64_t)(0xFFFF - pImage->width) << 16) | index;
+    }
+    qsort(order, pAtlas->imageCount, sizeof(uint64_t), &_compare_pack_keys);
+
+    Skyline* pSkylines = (Skyline*)malloc(sizeof(Skyline) * GFX_ATLAS_MAX_PAGES);
+    DBG_ASSERT(pSkylines != NULL, "Failed to allocate atlas skylines");
+    if (pSkylines == NULL) return UT_FALSE;
+    pAtlas->pageCount = 0;
+    for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+        GfxAtlasImage* pImage = &pAtlas->images[order[index] & 0xFFFF];
+        uint32_t width = pImage->width + GFX_ATLAS_PADDING;
+        uint32_t height = pImage->height + GFX_ATLAS_PADDING;
+        uint32_t x = 0, y = 0, page = 0;
+        while (page < pAtlas->pageCount && !_skyline_pack(&pSkylines[page], width, height, &x, &y)) {
+            ++page;
+        }
+        if (page == pAtlas->pageCount) {
+            if (page == GFX_ATLAS_MAX_PAGES) {
+                DBG_ASSERT(0, "Atlas images don't fit in %u pages", GFX_ATLAS_MAX_PAGES);
+                free(pSkylines);
+                return UT_FALSE;
+            }
+            Skyline* pSkyline = &pSkylines[page];
+            pSkyline->nodes[0].x = 0;
+            pSkyline->nodes[0].y = 0;
+            pSkyline->nodes[0].width = GFX_ATLAS_PAGE_SIZE;
+            pSkyline->count = 1;
+            pAtlas->pageCount += 1;
+            if (!_skyline_pack(pSkyline, width, height, &x, &y)) {
+                DBG_ASSERT(0, "Atlas image of %ux%u doesn't fit in a %u page", pImage->width, pImage->height, GFX_ATLAS_PAGE_SIZE);
+                free(pSkylines);
+                return UT_FALSE;
+            }
+        }
+        pImage->page = (uint16_t)page;
+        pImage->x = (uint16_t)x;
+        pImage->y = (uint16_t)y;
+    }
+    free(pSkylines);
+    return UT_TRUE;
+}
+
+static bool32_t _read_layout_cache(GfxAtlas* pAtlas, const char* pCachePath) {
+    FILE* pFile = fopen(pCachePath, "rb");
+    if (pFile == NULL) return UT_FALSE;
+    AtlasCacheHeader header;
+    AtlasCacheEntry entries[GFX_ATLAS_MAX_IMAGES];
+    bool32_t isValid = fread(&header, sizeof(header), 1, pFile) == 1 &&
+        header.magic == ATLAS_CACHE_MAGIC && header.version == ATLAS_CACHE_VERSION &&
+        header.pageSize == GFX_ATLAS_PAGE_SIZE && header.padding == GFX_ATLAS_PADDING &&
+        header.imageCount == pAtlas->imageCount && header.pageCount <= GFX_ATLAS_MAX_PAGES &&
+        fread(entries, sizeof(AtlasCacheEntry), header.imageCount, pFile) == header.imageCount;
+    fclose(pFile);
+    for (uint32_t index = 0; isValid && index < pAtlas->imageCount; ++index) {
+        const GfxAtlasImage* pImage = &pAtlas->images[index];
+        const AtlasCacheEntry* pEntry = &entries[index];
+        isValid = pEntry->nameHash == pImage->nameHash && pEntry->width == pImage->width &&
+            pEntry->height == pImage->height && pEntry->page < header.pageCount &&
+            (uint32_t)pEntry->x + pEntry->width + GFX_ATLAS_PADDING <= GFX_ATLAS_PAGE_SIZE &&
+            (uint32_t)pEntry->y + pEntry->height + GFX_ATLAS_PADDING <= GFX_ATLAS_PAGE_SIZE;
+    }
+    if (!isValid) return UT_FALSE;
+    for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+        pAtlas->images[index].page = entries[index].page;
+        pAtlas->images[index].x = entries[index].x;
+        pAtlas->images[index].y = entries[index].y;
+    }
+    pAtlas->pageCount = header.pageCount;
+    return UT_TRUE;
+}
+
+static void _write_layout_cache(const GfxAtlas* pAtlas, const char* pCachePath) {
+    FILE* pFile = fopen(pCachePath, "wb");
+    if (pFile == NULL) {
+        fprintf(stderr, "Failed to write atlas cache %s\n", pCachePath);
+        return;
+    }
+    AtlasCacheHeader header = { ATLAS_CACHE_MAGIC, ATLAS_CACHE_VERSION, GFX_ATLAS_PAGE_SIZE, GFX_ATLAS_PADDING, pAtlas->imageCount, pAtlas->pageCount };
+    fwrite(&header, sizeof(header), 1, pFile);
+    for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+        const GfxAtlasImage* pImage = &pAtlas->images[index];
+        AtlasCacheEntry entry = { pImage->nameHash, pImage->width, pImage->height, pImage->page, pImage->x, pImage->y, 0 };
+        fwrite(&entry, sizeof(entry), 1, pFile);
+    }
+    fclose(pFile);
+}
+
+static void _release_pixels(GfxAtlas* pAtlas) {
+    for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+        GfxAtlasImage* pImage = &pAtlas->images[index];
+        if (pImage->isLoaded) {
+            _gfx_free_image(pImage->pPixels);
+        }
+        pImage->pPixels = NULL;
+        pImage->isLoaded = UT_FALSE;
+    }
+}
+
+/* Pages are only as large as their packed content, rounded up to a power of two. */
+static bool32_t _create_pages(GfxAtlas* pAtlas) {
+    byte_t* pPagePixels = (byte_t*)malloc((size_t)GFX_ATLAS_PAGE_SIZE * GFX_ATLAS_PAGE_SIZE * 4);
+    DBG_ASSERT(pPagePixels != NULL, "Failed to allocate atlas page pixels");
+    if (pPagePixels == NULL) return UT_FALSE;
+    for (uint32_t page = 0; page < pAtlas->pageCount; ++page) {
+        uint32_t pageWidth = 1, pageHeight = 1;
+        for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+            const GfxAtlasImage* pImage = &pAtlas->images[index];
+            if (pImage->page != page) continue;
+            pageWidth = UT_MAX(pageWidth, (uint32_t)(pImage->x + pImage->width));
+            pageHeight = UT_MAX(pageHeight, (uint32_t)(pImage->y + pImage->height));
+        }
+        UT_ROUND_POT(pageWidth);
+        UT_ROUND_POT(pageHeight);
+        memset(pPagePixels, 0, (size_t)pageWidth * pageHeight * 4);
+        for (uint32_t index = 0; index < pAtlas->imageCount; ++index) {
+            const GfxAtlasImage* pImage = &pAtlas->images[index];
+            if (pImage->page != page) continue;
+            for (uint32_t row = 0; row < pImage->height; ++row) {
+                byte_t* pDst = pPagePixels + ((size_t)(pImage->y + row) * pageWidth + pImage->x) * 4;
+                const byte_t* pSrc = pImage->pPixels + (size_t)row * pImage->width * 4;
+                memcpy(pDst, pSrc, (size_t)pImage->width * 4);
+            }
+        }
+        pAtlas->pages[page] = gfx_create_texture(pageWidth, pageHeight, pPagePixels);
+        DBG_ASSERT(pAtlas->pages[page] != INVALID_TEXTURE_ID, "Failed to create atlas page %u", page);
+    }
+    free(pPagePixels);
+    return UT_TRUE;
+}
+
+bool32_t gfx_atlas_build(GfxAtlas* pAtlas, const char* pCachePath) {
+    DBG_ASSERT(!pAtlas->isBuilt, "Atlas is already built");
+    bool32_t hasLayout = pCachePath != NULL && _read_layout_cache(pAtlas, pCachePath);
+    if (!hasLayout) {
+        if (!_pack_images(pAtlas)) {
+            _release_pixels(pAtlas);
+            return UT_FALSE;
+        }
+        if (pCachePath != NULL) {
+            _write_layout_cache(pAtlas, pCachePath);
+        }
+    }
+    bool32_t hasPages = _create_pages(pAtlas);
+    _release_pixels(pAtlas);
+    if (!hasPages) return UT_FALSE;
+    pAtlas->isBuilt = UT_TRUE;
+    return UT_TRUE;
+}
+
+GfxAtlasRegion gfx_atlas_get_region(const GfxAtlas* pAtlas, uint32_t image) {
+    DBG_ASSERT(pAtlas->isBuilt, "Atlas needs to be built before reading regions");
+    DBG_ASSERT(image < pAtlas->imageCount, "Invalid atlas image %u", image);
+    const GfxAtlasImage* pImage = &pAtlas->images[image];
+    GfxAtlasRegion region = { pAtlas->pages[pImage->page], pImage->x, pImage->y, pImage->width, pImage->height };
+    return region;
+}
@@ -0,0 +1,54 @@
+#ifndef _GFX_ATLAS_H_
+#define _GFX_ATLAS_H_
+
+#include "types.h"
+#include "gfx.h"
+
+/*
+ Packs many source images into a few shared texture pages with a skyline packer,
+ so sprites from different files can land in the same draw batch.
+ Usage: gfx_atlas_initialize, add every image, then gfx_atlas_build once gfx is
+ initialized. Regions are plain sub-rects of a page and can be passed straight to
+ gfx_draw_texture_frame_with_color and friends.
+ When a cache path is given the packed layout is written there, and later builds
+ with the same images (same names and sizes, same order) reuse it without packing.
+*/
+
+#define GFX_ATLAS_PAGE_SIZE 2048
+#define GFX_ATLAS_PADDING 1
+#define GFX_ATLAS_MAX_PAGES 8
+#define GFX_ATLAS_MAX_IMAGES 256
+#define GFX_ATLAS_INVALID_IMAGE ((uint32_t)-1)
+
+typedef struct {
+    TextureID texture;
+    uint16_t x, y;
+    uint16_t width, height;
+} GfxAtlasRegion;
+
+typedef struct {
+    byte_t* pPixels;
+    uint32_t nameHash;
+    uint16_t width, height;
+    uint16_t page, x, y;
+    bool32_t isLoaded;
+} GfxAtlasImage;
+
+typedef struct {
+    GfxAtlasImage images[GFX_ATLAS_MAX_IMAGES];
+    TextureID pages[GFX_ATLAS_MAX_PAGES];
+    uint32_t imageCount;
+    uint32_t pageCount;
+    bool32_t isBuilt;
+} GfxAtlas;
+
+void gfx_atlas_initialize(GfxAtlas* pAtlas);
+/* Loads the image the same way gfx_load_texture does. Returns GFX_ATLAS_INVALID_IMAGE on failure. */
+uint32_t gfx_atlas_add_image(GfxAtlas* pAtlas, const char* pImagePath);
+/* RGBA8 pixels are not copied and must stay alive until gfx_atlas_build returns. pName identifies the image in the cache. */
+uint32_t gfx_atlas_add_pixels(GfxAtlas* pAtlas, const char* pName, uint32_t width, uint32_t height, const void* pPixels);
+/* Packs (or reads the layout from pCachePath, which may be NULL), creates the pages and releases the source pixels. */
+bool32_t gfx_atlas_build(GfxAtlas* pAtlas, const char* pCachePath);
+GfxAtlasRegion gfx_atlas_get_region(const GfxAtlas* pAtlas, uint32_t image);
+
+#endif
@@ -0,0 +1,494 @@
+#include "gfx_batch.h"
+#include "math.h"
+#include "utils.h"
+#include "assert.h"
+#include <stdlib.h>
+#include <string.h>
+
+GfxBatchState gGfxBatch = { 0 };
+
+void _gfx_batch_initialize(void) {
+    gGfxBatch.vertices.pBuffer = (TextureColorVertex*)malloc(sizeof(TextureColorVertex) * GFX_MAX_VERTICES);
+    gGfxBatch.batchBuffer.pBuffer = (DrawBatch*)malloc(sizeof(DrawBatch) * GFX_MAX_BATCHES);
+    gGfxBatch.instances.pBuffer = (SpriteInstance*)malloc(sizeof(SpriteInstance) * GFX_MAX_INSTANCES);
+    gGfxBatch.pQuadIndices = (uint16_t*)malloc(sizeof(uint16_t) * GFX_MAX_INDICES);
+    gGfxBatch.pQuadKeys = (uint64_t*)malloc(sizeof(uint64_t) * GFX_MAX_QUADS);
+    gGfxBatch.pSortKeys = (uint64_t*)malloc(sizeof(uint64_t) * GFX_MAX_QUADS);
+    gGfxBatch.pSortOrder = (uint16_t*)malloc(sizeof(uint16_t) * GFX_MAX_QUADS * 2);
+    gGfxBatch.pSortVertices = (TextureColorVertex*)malloc(sizeof(TextureColorVertex) * GFX_MAX_VERTICES);
+    gGfxBatch.pSortTextures = (TextureID*)malloc(sizeof(TextureID) * GFX_MAX_BATCHES);
+    DBG_ASSERT(gGfxBatch.vertices.pBuffer != NULL, "Failed to allocate buffer for vertices");
+    DBG_ASSERT(gGfxBatch.batchBuffer.pBuffer != NULL, "Failed to allocate buffer for draw batching");
+    DBG_ASSERT(gGfxBatch.instances.pBuffer != NULL, "Failed to allocate buffer for sprite instances");
+    DBG_ASSERT(gGfxBatch.pQuadIndices != NULL, "Failed to allocate buffer for quad indices");
+    DBG_ASSERT(gGfxBatch.pQuadKeys != NULL && gGfxBatch.pSortKeys != NULL && gGfxBatch.pSortOrder != NULL, "Failed to allocate buffers for draw sorting");
+    DBG_ASSERT(gGfxBatch.pSortVertices != NULL && gGfxBatch.pSortTextures != NULL, "Failed to allocate buffers for draw sorting");
+    for (uint32_t quad = 0; quad < GFX_MAX_QUADS; ++quad) {
+        uint16_t* pIndices = &gGfxBatch.pQuadIndices[quad * 6];
+        uint16_t vertex = (uint16_t)(quad * 4);
+        pIndices[0] = vertex;
+        pIndices[1] = vertex + 1;
+        pIndices[2] = vertex + 2;
+        pIndices[3] = vertex;
+        pIndices[4] = vertex + 2;
+        pIndices[5] = vertex + 3;
+    }
+    gGfxBatch.matrixStack.index = 0;
+    mat2dIdent(&gGfxBatch.matrixStack.matrix);
+    gGfxBatch.pipelineID = PIPELINE_TEXTURE;
+    gGfxBatch.hasInstancing = UT_FALSE;
+    gGfxBatch.hasPendingPoint = UT_FALSE;
+    gGfxBatch.isDeferred = UT_FALSE;
+    gGfxBatch.sortLayer = 0;
+    gfx_set_sort_depth(0.0f);
+    uint32_t white = 0xFFFFFFFF;
+    gGfxBatch.whiteTexture = gfx_create_texture(1, 1, &white);
+    DBG_ASSERT(gGfxBatch.whiteTexture != INVALID_TEXTURE_ID, "Failed to create white texture for lines");
+    _gfx_batch_reset();
+}
+
+void _gfx_batch_set_instancing(bool32_t enabled) {
+    gGfxBatch.hasInstancing = enabled;
+}
+
+void _gfx_batch_shutdown(void) {
+    free(gGfxBatch.vertices.pBuffer);
+    free(gGfxBatch.batchBuffer.pBuffer);
+    free(gGfxBatch.instances.pBuffer);
+    free(gGfxBatch.pQuadIndices);
+    free(gGfxBatch.pQuadKeys);
+    free(gGfxBatch.pSortKeys);
+    free(gGfxBatch.pSortOrder);
+    free(gGfxBatch.pSortVertices);
+    free(gGfxBatch.pSortTextures);
+    gGfxBatch.vertices.pBuffer = NULL;
+    gGfxBatch.batchBuffer.pBuffer = NULL;
+    gGfxBatch.instances.pBuffer = NULL;
+    gGfxBatch.pQuadIndices = NULL;
+    gGfxBatch.pQuadKeys = NULL;
+    gGfxBatch.pSortKeys = NULL;
+    gGfxBatch.pSortOrder = NULL;
+    gGfxBatch.pSortVertices = NULL;
+    gGfxBatch.pSortTextures = NULL;
+    _gfx_batch_reset();
+}
+
+void _gfx_batch_reset(void) {
+    gGfxBatch.currentTexture = (void*)0xDEADBEEF;
+    gGfxBatch.pCurrentBatch = NULL;
+    gGfxBatch.batchBuffer.count = 0;
+    gGfxBatch.vertices.count = 0;
+    gGfxBatch.instances.count = 0;
+    gGfxBatch.sortTextureCount = 0;
+}
+
+void _gfx_batch_end_frame(void) {
+#if GFX_ENABLE_STATS
+    gGfxBatch.lastFrameStats = gGfxBatch.frameStats;
+    memset(&gGfxBatch.frameStats, 0, sizeof(GfxFrameStats));
+#endif
+}
+
+GfxFrameStats gfx_get_frame_stats(void) {
+#if GFX_ENABLE_STATS
+    return gGfxBatch.lastFrameStats;
+#else
+    GfxFrameStats stats = { 0 };
+    return stats;
+#endif
+}
+
+/* LSD radix sort on 8 bit digits. Bytes every key shares are skipped, which is usually most of the layer and depth passes. */
+static const uint16_t* _sort_quad_keys(uint32_t quadCount) {
+    uint32_t histograms[8][256];
+    uint64_t* pSrcKeys = gGfxBatch.pQuadKeys;
+    uint64_t* pDstKeys = gGfxBatch.pSortKeys;
+    uint16_t* pSrcOrder = gGfxBatch.pSortOrder;
+    uint16_t* pDstOrder = gGfxBatch.pSortOrder + GFX_MAX_QUADS;
+    memset(histograms, 0, sizeof(histograms));
+    for (uint32_t quad = 0; quad < quadCount; ++quad) {
+        uint64_t key = pSrcKeys[quad];
+        for (uint32_t pass = 0; pass < 8; ++pass) {
+            histograms[pass][(key >> (pass * 8)) & 0xFF] += 1;
+        }
+        pSrcOrder[quad] = (uint16_t)quad;
+    }
+    for (uint32_t pass = 0; pass < 8; ++pass) {
+        uint32_t* pHistogram = histograms[pass];
+        uint32_t shift = pass * 8;
+        if (pHistogram[(pSrcKeys[0] >> shift) & 0xFF] == quadCount) continue;
+        uint32_t offset = 0;
+        for (uint32_t digit = 0; digit < 256; ++digit) {
+            uint32_t count = pHistogram[digit];
+            pHistogram[digit] = offset;
+            offset += count;
+        }
+        for (uint32_t index = 0; index < quadCount; ++index) {
+            uint32_t slot = pHistogram[(pSrcKeys[index] >> shift) & 0xFF]++;
+            pDstKeys[slot] = pSrcKeys[index];
+            pDstOrder[slot] = pSrcOrder[index];
+        }
+        uint64_t* pTempKeys = pSrcKeys;
+        uint16_t* pTempOrder = pSrcOrder;
+        pSrcKeys = pDstKeys;
+        pSrcOrder = pDstOrder;
+        pDstKeys = pTempKeys;
+        pDstOrder = pTempOrder;
+    }
+    /* Leave the sorted keys in pQuadKeys so batches can be rebuilt from them. */
+    if (pSrcKeys != gGfxBatch.pQuadKeys) {
+        memcpy(gGfxBatch.pQuadKeys, pSrcKeys, sizeof(uint64_t) * quadCount);
+    }
+    return pSrcOrder;
+}
+
+void _gfx_batch_sort(void) {
+    uint32_t quadCount = gGfxBatch.vertices.count / 4;
+    if (!gGfxBatch.isDeferred || quadCount == 0) return;
+    const uint16_t* pOrder = _sort_quad_keys(quadCount);
+    const TextureColorVertex* pSrcVertices = gGfxBatch.vertices.pBuffer;
+    TextureColorVertex* pDstVertices = gGfxBatch.pSortVertices;
+    for (uint32_t quad = 0; quad < quadCount; ++quad) {
+        memcpy(&pDstVertices[quad * 4], &pSrcVertices[pOrder[quad] * 4], sizeof(TextureColorVertex) * 4);
+    }
+    gGfxBatch.pSortVertices = gGfxBatch.vertices.pBuffer;
+    gGfxBatch.vertices.pBuffer = pDstVertices;
+
+    /* Every texture change in call order opened a batch, so the sorted runs always fit in the batch buffer. */
+    DrawBatch* pBatch = NULL;
+    TextureID texture = (void*)0xDEADBEEF;
+    gGfxBatch.batchBuffer.count = 0;
+    for (uint32_t quad = 0; quad < quadCount; ++quad) {
+        uint32_t slot = (uint32_t)(gGfxBatch.pQuadKeys[quad] >> GFX_SORT_TEXTURE_SHIFT) & GFX_SORT_TEXTURE_MASK;
+        if (gGfxBatch.pSortTextures[slot] != texture) {
+            DBG_ASSERT(gGfxBatch.batchBuffer.count < GFX_MAX_BATCHES, "Sorted draws need more than %u batches", GFX_MAX_BATCHES);
+            texture = gGfxBatch.pSortTextures[slot];
+            pBatch = &gGfxBatch.batchBuffer.pBuffer[gGfxBatch.batchBuffer.count++];
+            DrawBatch batch = { .texture = texture, .type = GFX_BATCH_QUADS, .count = 0, .offset = quad * 6 };
+            *pBatch = batch;
+        }
+        pBatch->count += 6;
+    }
+    gGfxBatch.pCurrentBatch = pBatch;
+}
+
+static inline TextureColorVertex _transform_vertex(float32_t x, float32_t y, float32_t u, float32_t v, uint32_t color) {
+    vec2_t output = { 0.0f, 0.0f };
+    vec2_t input = { x, y };
+    mat2DVec2Mul(&output, &gGfxBatch.matrixStack.matrix, &input);
+    TextureColorVertex vertex = { { output.x, output.y }, { u, v }, color };
+    return vertex;
+}
+
+/* Accounts for count quads just written at the end of the vertex buffer and tags them with the sort key when deferred. */
+static inline void _commit_quads(uint32_t count) {
+    if (gGfxBatch.isDeferred) {
+        uint64_t key = gGfxBatch.sortStateKey | gGfxBatch.sortDepthBits;
+        uint64_t* pKeys = &gGfxBatch.pQuadKeys[gGfxBatch.vertices.count / 4];
+        for (uint32_t index = 0; index < count; ++index) {
+            pKeys[index] = key;
+        }
+    }
+    gGfxBatch.vertices.count += count * 4;
+    gGfxBatch.pCurrentBatch->count += count * 6;
+    GFX_STATS_ADD(vertices, count * 4);
+}
+
+static inline void _push_quad(float32_t x, float32_t y, float32_t w, float32_t h, float32_t u0, float32_t v0, float32_t u1, float32_t v1, uint32_t color) {
+    /* Four scalar transforms, the batch kernels only pay off on whole arrays. */
+    TextureColorVertex vert0 = _transform_vertex(x, y, u0, v0, color);
+    TextureColorVertex vert1 = _transform_vertex(x, y + h, u0, v1, color);
+    TextureColorVertex vert2 = _transform_vertex(x + w, y + h, u1, v1, color);
+    TextureColorVertex vert3 = _transform_vertex(x + w, y, u1, v0, color);
+    TextureColorVertex* pVertices = &gGfxBatch.vertices.pBuffer[gGfxBatch.vertices.count];
+    pVertices[0] = vert0;
+    pVertices[1] = vert1;
+    pVertices[2] = vert2;
+    pVertices[3] = vert3;
+    _commit_quads(1);
+}
+
+static void _create_batch(TextureID texture, uint32_t type) {
+    if (gGfxBatch.batchBuffer.count >= GFX_MAX_BATCHES) {
+        GFX_STATS_ADD(capFlushes, 1);
+        gfx_flush();
+    }
+    uint32_t offset = type == GFX_BATCH_QUADS ? gGfxBatch.vertices.count / 4 * 6 : gGfxBatch.instances.count;
+    DrawBatch batch = { .texture = texture, .type = type, .count = 0, .offset = offset };
+    DrawBatch* pDst = &gGfxBatch.batchBuffer.pBuffer[gGfxBatch.batchBuffer.count];
+    *pDst = batch;
+    gGfxBatch.pCurrentBatch = &gGfxBatch.batchBuffer.pBuffer[gGfxBatch.batchBuffer.count++];
+}
+
+/* Layer, pipeline and texture part of the sort key. Texture slots are handed out per flush in order of first use. */
+static uint64_t _sort_state_key(TextureID texture) {
+    uint32_t slot = 0;
+    while (slot < gGfxBatch.sortTextureCount && gGfxBatch.pSortTextures[slot] != texture) {
+        ++slot;
+    }
+    if (slot == gGfxBatch.sortTextureCount) {
+        gGfxBatch.pSortTextures[gGfxBatch.sortTextureCount++] = texture;
+    }
+    return ((uint64_t)gGfxBatch.sortLayer << GFX_SORT_LAYER_SHIFT) |
+           ((uint64_t)gGfxBatch.pipelineID << GFX_SORT_PIPELINE_SHIFT) |
+           ((uint64_t)slot << GFX_SORT_TEXTURE_SHIFT);
+}
+
+/* Flushes when the vertex buffer is full and makes sure the current batch draws texId. Returns how many of count quads fit. */
+static uint32_t _reserve_quads(TextureID texId, uint32_t count) {
+    if (gGfxBatch.vertices.count + 4 > GFX_MAX_VERTICES) {
+        GFX_STATS_ADD(capFlushes, 1);
+        gfx_flush();
+    }
+    if (texId != gGfxBatch.currentTexture) {
+        _create_batch(texId, GFX_BATCH_QUADS);
+        gGfxBatch.currentTexture = texId;
+        if (gGfxBatch.isDeferred) {
+            gGfxBatch.sortStateKey = _sort_state_key(texId);
+        }
+    }
+    uint32_t available = (GFX_MAX_VERTICES - gGfxBatch.vertices.count) / 4;
+    return count < available ? count : available;
+}
+
+/*
+ Writes the quad of a frame of halfW by halfH texels centered at (x, y), scaled, then rotated by the angle with
+ sine sn and cosine cs. Same result as translate, rotate, scale and a frame drawn at -size/2, without the matrix
+ stack round trip: the two local axes and the centre go through the current matrix once and the corners are sums of them.
+*/
+static inline void _write_trs_quad(TextureColorVertex* pQuad, float32_t x, float32_t y, float32_t halfW, float32_t halfH, float32_t scaleX, float32_t scaleY,
+                                   float32_t sn, float32_t cs, float32_t u0, float32_t v0, float32_t u1, float32_t v1, uint32_t color) {
+    const mat2d_t* pMatrix = &gGfxBatch.matrixStack.matrix;
+    float32_t axisXx = cs * scaleX * halfW, axisXy = sn * scaleX * halfW;
+    float32_t axisYx = -sn * scaleY * halfH, axisYy = cs * scaleY * halfH;
+    float32_t ax = axisXx * pMatrix->a + axisXy * pMatrix->c, ay = axisXx * pMatrix->b + axisXy * pMatrix->d;
+    float32_t bx = axisYx * pMatrix->a + axisYy * pMatrix->c, by = axisYx * pMatrix->b + axisYy * pMatrix->d;
+    float32_t cx = x * pMatrix->a + y * pMatrix->c + pMatrix->tx;
+    float32_t cy = x * pMatrix->b + y * pMatrix->d + pMatrix->ty;
+    pQuad[0] = (TextureColorVertex) { { cx - ax - bx, cy - ay - by }, { u0, v0 }, color };
+    pQuad[1] = (TextureColorVertex) { { cx - ax + bx, cy - ay + by }, { u0, v1 }, color };
+    pQuad[2] = (TextureColorVertex) { { cx + ax + bx, cy + ay + by }, { u1, v1 }, color };
+    pQuad[3] = (TextureColorVertex) { { cx + ax - bx, cy + ay - by }, { u1, v0 }, color };
+}
+
+/* Rotations are turned into sines and cosines this many instances at a time with sinCosBatch. */
+#define GFX_SINCOS_CHUNK 64
+
+static void _expand_sprite_instances(const SpriteInstance* pInstances, uint32_t count, float32_t invWidth, float32_t invHeight) {
+    TextureColorVertex* pVertices = &gGfxBatch.vertices.pBuffer[gGfxBatch.vertices.count];
+    float32_t radians[GFX_SINCOS_CHUNK];
+    float32_t sines[GFX_SINCOS_CHUNK];
+    float32_t cosines[GFX_SINCOS_CHUNK];
+    for (uint32_t base = 0; base < count; base += GFX_SINCOS_CHUNK) {
+        uint32_t chunk = UT_MIN(count - base, GFX_SINCOS_CHUNK);
+        for (uint32_t index = 0; index < chunk; ++index) {
+            radians[index] = pInstances[base + index].rotation;
+        }
+        sinCosBatch(sines, cosines, radians, chunk);
+        for (uint32_t index = 0; index < chunk; ++index) {
+            const SpriteInstance* pInstance = &pInstances[base + index];
+            float32_t u0 = (float32_t)pInstance->frameX * invWidth;
+            float32_t v0 = (float32_t)pInstance->frameY * invHeight;
+            float32_t u1 = (float32_t)(pInstance->frameX + pInstance->frameW) * invWidth;
+            float32_t v1 = (float32_t)(pInstance->frameY + pInstance->frameH) * invHeight;
+            _write_trs_quad(&pVertices[(base + index) * 4], pInstance->position.x, pInstance->position.y, (float32_t)pInstance->frameW * 0.5f, (float32_t)pInstance->frameH * 0.5f,
+                            pInstance->scale.x, pInstance->scale.y, sines[index], cosines[index], u0, v0, u1, v1, pInstance->color);
+        }
+    }
+    _commit_quads(count);
+}
+
+void gfx_draw_texture(TextureID texture, float32_t x, float32_t y) {
+    gfx_draw_texture_with_color(texture, x, y, 0xFFFFFFFF);
+}
+
+void gfx_draw_texture_with_color(TextureID texture, float32_t x, float32_t y, uint32_t color) {
+    DBG_ASSERT(gGfxBatch.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
+    _reserve_quads(texture, 1);
+    vec2_t size = gfx_get_texture_size(texture);
+    _push_quad(x, y, size.x, size.y, 0.0f, 0.0f, 1.0f, 1.0f, color);
+}
+
+void gfx_draw_texture_frame(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh) {
+    gfx_draw_texture_frame_with_color(texture, x, y, fx, fy, fw, fh, 0xFFFFFFFF);
+}
+
+void gfx_draw_texture_frame_with_color(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, uint32_t color) {
+    DBG_ASSERT(gGfxBatch.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
+    _reserve_quads(texture, 1);
+    vec2_t size = gfx_get_texture_size(texture);
+    float32_t u0 = fx / size.x;
+    float32_t v0 = fy / size.y;
+    float32_t u1 = (fx + fw) / size.x;
+    float32_t v1 = (fy + fh) / size.y;
+    _push_quad(x, y, fw, fh, u0, v0, u1, v1, color);
+}
+
+void gfx_draw_texture_frame_trs(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, float32_t rotation, float32_t scaleX, float32_t scaleY) {
+    gfx_draw_texture_frame_trs_with_color(texture, x, y, fx, fy, fw, fh, rotation, scaleX, scaleY, 0xFFFFFFFF);
+}
+
+void gfx_draw_texture_frame_trs_with_color(TextureID texture, float32_t x, float32_t y, float32_t fx, float32_t fy, float32_t fw, float32_t fh, float32_t rotation, float32_t scaleX, float32_t scaleY, uint32_t color) {
+    DBG_ASSERT(gGfxBatch.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
+    _reserve_quads(texture, 1);
+    vec2_t size = gfx_get_texture_size(texture);
+    float32_t u0 = fx / size.x;
+    float32_t v0 = fy / size.y;
+    float32_t u1 = (fx + fw) / size.x;
+    float32_t v1 = (fy + fh) / size.y;
+    float32_t sn, cs;
+    sinCos(rotation, &sn, &cs);
+    _write_trs_quad(&gGfxBatch.vertices.pBuffer[gGfxBatch.vertices.count], x, y, fw * 0.5f, fh * 0.5f, scaleX, scaleY, sn, cs, u0, v0, u1, v1, color);
+    _commit_quads(1);
+}
+
+void gfx_draw_sprite_instances(TextureID texture, const SpriteInstance* pInstances, uint32_t count) {
+    DBG_ASSERT(gGfxBatch.pipelineID == PIPELINE_TEXTURE, "Need to set pipeline to PIPELINE_TEXTURE to draw textures.");
+    if (count == 0) return;
+    if (gGfxBatch.hasInstancing && !gGfxBatch.isDeferred) {
+        while (count > 0) {
+            if (gGfxBatch.instances.count >= GFX_MAX_INSTANCES) {
+                GFX_STATS_ADD(capFlushes, 1);
+                gfx_flush();
+            }
+            uint32_t available = GFX_MAX_INSTANCES - gGfxBatch.instances.count;
+            uint32_t chunk = count < available ? count : available;
+            _create_batch(texture, GFX_BATCH_INSTANCES);
+            gGfxBatch.pCurrentBatch->count = chunk;
+            gGfxBatch.pCurrentBatch->transform = gGfxBatch.matrixStack.matrix;
+            memcpy(&gGfxBatch.instances.pBuffer[gGfxBatch.instances.count], pInstances, sizeof(SpriteInstance) * chunk);
+            gGfxBatch.instances.count += chunk;
+            GFX_STATS_ADD(instances, chunk);
+            /* Quads drawn after this need a batch of their own. */
+            gGfxBatch.currentTexture = (void*)0xDEADBEEF;
+            pInstances += chunk;
+            count -= chunk;
+        }
+    } else {
+        vec2_t size = gfx_get_texture_size(texture);
+        while (count > 0) {
+            uint32_t chunk = _reserve_quads(texture, count);
+            _expand_sprite_instances(pInstances, chunk, 1.0f / size.x, 1.0f / size.y);
+            pInstances += chunk;
+            count -= chunk;
+        }
+    }
+}
+
+void gfx_push_matrix(void) {
+    if (gGfxBatch.matrixStack.index < GFX_MAX_MATRICES) {
+        gGfxBatch.matrixStack.matrices[gGfxBatch.matrixStack.index++] = gGfxBatch.matrixStack.matrix;
+    }
+}
+
+void gfx_pop_matrix(void) {
+    if (gGfxBatch.matrixStack.index > 0) {
+        gGfxBatch.matrixStack.matrix = gGfxBatch.matrixStack.matrices[--gGfxBatch.matrixStack.index];
+    }
+}
+
+void gfx_translate(float32_t x, float32_t y) {
+    mat2d_t result = gGfxBatch.matrixStack.matrix;
+    mat2DTranslate(&result, &gGfxBatch.matrixStack.matrix, x, y);
+    gGfxBatch.matrixStack.matrix = result;
+}
+
+void gfx_scale(float32_t x, float32_t y) {
+    mat2d_t result = gGfxBatch.matrixStack.matrix;
+    mat2DScale(&result, &gGfxBatch.matrixStack.matrix, x, y);
+    gGfxBatch.matrixStack.matrix = result;
+}
+
+void gfx_rotate(float32_t r) {
+    mat2d_t result = gGfxBatch.matrixStack.matrix;
+    mat2DRotate(&result, &gGfxBatch.matrixStack.matrix, r);
+    gGfxBatch.matrixStack.matrix = result;
+}
+
+void gfx_rotate_rot2(rot2_t rotation) {
+    mat2d_t result = gGfxBatch.matrixStack.matrix;
+    mat2DRotateSinCos(&result, &gGfxBatch.matrixStack.matrix, rotation.s, rotation.c);
+    gGfxBatch.matrixStack.matrix = result;
+}
+
+void gfx_load_identity(void) {
+    mat2dIdent(&gGfxBatch.matrixStack.matrix);
+}
+
+/* Lines are quads one pixel wide around the segment, drawn with the white texel so they batch with textured quads. */
+static void _push_line(const PointVertex* pV0, const PointVertex* pV1) {
+    float32_t dx = pV1->position.x - pV0->position.x;
+    float32_t dy = pV1->position.y - pV0->position.y;
+    float32_t length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f) return;
+    _reserve_quads(gGfxBatch.whiteTexture, 1);
+    float32_t nx = -dy / length * 0.5f;
+    float32_t ny = dx / length * 0.5f;
+    TextureColorVertex* pVertices = &gGfxBatch.vertices.pBuffer[gGfxBatch.vertices.count];
+    pVertices[0] = (TextureColorVertex) { { pV0->position.x + nx, pV0->position.y + ny }, { 0.5f, 0.5f }, pV0->color };
+    pVertices[1] = (TextureColorVertex) { { pV0->position.x - nx, pV0->position.y - ny }, { 0.5f, 0.5f }, pV0->color };
+    pVertices[2] = (TextureColorVertex) { { pV1->position.x - nx, pV1->position.y - ny }, { 0.5f, 0.5f }, pV1->color };
+    pVertices[3] = (TextureColorVertex) { { pV1->position.x + nx, pV1->position.y + ny }, { 0.5f, 0.5f }, pV1->color };
+    _commit_quads(1);
+}
+
+void gfx_vertex2(float32_t x, float32_t y, uint32_t color) {
+    DBG_ASSERT(gGfxBatch.pipelineID == PIPELINE_LINE, "Need to set pipeline to PIPELINE_LINE to draw lines.");
+    vec2_t output = { 0.0f, 0.0f };
+    vec2_t input = { x, y };
+    mat2DVec2Mul(&output, &gGfxBatch.matrixStack.matrix, &input);
+    PointVertex vertex = { { output.x, output.y }, color };
+    GFX_STATS_ADD(points, 1);
+    if (gGfxBatch.hasPendingPoint) {
+        gGfxBatch.hasPendingPoint = UT_FALSE;
+        _push_line(&gGfxBatch.pendingPoint, &vertex);
+    } else {
+        gGfxBatch.pendingPoint = vertex;
+        gGfxBatch.hasPendingPoint = UT_TRUE;
+    }
+}
+
+void gfx_line2(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color0, uint32_t color1) {
+    gfx_vertex2(x0, y0, color0);
+    gfx_vertex2(x1, y1, color1);
+}
+
+void gfx_line(float32_t x0, float32_t y0, float32_t x1, float32_t y1, uint32_t color) {
+    gfx_line2(x0, y0, x1, y1, color, color);
+}
+
+/* Both pipelines draw through the same vertex format and shader, so switching only changes which draw calls are valid. */
+bool32_t gfx_set_pipeline(uint32_t pipeline) {
+    if (pipeline < GFX_MAX_PIPELINES && gGfxBatch.pipelineID != pipeline) {
+        gGfxBatch.pipelineID = pipeline;
+        GFX_STATS_ADD(pipelineSwitches, 1);
+        /* Start a new batch so deferred draws pick up the pipeline in their sort key. */
+        gGfxBatch.currentTexture = (void*)0xDEADBEEF;
+        return UT_TRUE;
+    }
+    return UT_FALSE;
+}
+
+void gfx_set_deferred(bool32_t enabled) {
+    if (gGfxBatch.isDeferred == enabled) return;
+    /* A flush is either all call order or all sorted. */
+    if (gGfxBatch.batchBuffer.count > 0) {
+        gfx_flush();
+    }
+    gGfxBatch.isDeferred = enabled;
+    gGfxBatch.currentTexture = (void*)0xDEADBEEF;
+}
+
+void gfx_set_sort_layer(uint32_t layer) {
+    DBG_ASSERT(layer < GFX_MAX_SORT_LAYERS, "Sort layer %u is out of range, the maximum is %u", layer, GFX_MAX_SORT_LAYERS - 1);
+    if (gGfxBatch.sortLayer == layer) return;
+    gGfxBatch.sortLayer = layer;
+    gGfxBatch.currentTexture = (void*)0xDEADBEEF;
+}
+
+/* Maps the float to an unsigned integer with the same ordering, negative depths included. */
+void gfx_set_sort_depth(float32_t depth) {
+    uint32_t bits = 0;
+    memcpy(&bits, &depth, sizeof(bits));
+    gGfxBatch.sortDepthBits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
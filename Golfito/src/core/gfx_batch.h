@@ -0,0 +1,142 @@
+#ifndef _GFX_BATCH_H_
+#define _GFX_BATCH_H_
+
+#include "types.h"
+#include "math.h"
+#include "gfx.h"
+#include "../config/config_gfx.h"
+
+/*
+ Platform-neutral batching shared by every gfx backend.
+ The batch module implements the matrix stack and the draw/line calls of gfx.h
+ and fills plain vertex, instance and batch arrays. Backends only upload and draw
+ those arrays in gfx_flush and then call _gfx_batch_reset.
+ Lines are expanded to 1 pixel wide quads sampling a white texel, so every
+ pipeline shares one vertex format and switching pipelines never flushes.
+ When a staging array fills up the batch module calls gfx_flush itself and
+ carries on, so a frame may flush several times.
+ In deferred mode quads are still written in call order along with a sort key each.
+ Backends call _gfx_batch_sort at the start of gfx_flush, which reorders the quads by
+ key and rebuilds the batch array, so sorting happens per flush.
+*/
+
+#define GFX_MAX_MATRICES 100
+#define GFX_MAX_QUADS 4096
+#define GFX_MAX_BATCHES 1000
+#define GFX_MAX_VERTICES (GFX_MAX_QUADS * 4)
+#define GFX_MAX_INDICES (GFX_MAX_QUADS * 6)
+#define GFX_MAX_INSTANCES GFX_MAX_QUADS
+#define GFX_MAX_PIPELINES 2
+#define GFX_MAX_SORT_LAYERS 256
+
+/* Sort key, most significant first: layer (8 bits) | pipeline (4) | texture slot (20) | depth (32). Depth sits below the texture so it never splits a batch. */
+#define GFX_SORT_LAYER_SHIFT 56
+#define GFX_SORT_PIPELINE_SHIFT 52
+#define GFX_SORT_TEXTURE_SHIFT 32
+#define GFX_SORT_TEXTURE_MASK 0xFFFFF
+
+#define GFX_BATCH_QUADS 0
+#define GFX_BATCH_INSTANCES 1
+
+#if GFX_MAX_VERTICES > 0x10000
+#error "Quad vertices must be addressable with 16 bit indices"
+#endif
+#if GFX_MAX_BATCHES > GFX_SORT_TEXTURE_MASK
+#error "Texture slots of the sort key can't address GFX_MAX_BATCHES textures"
+#endif
+
+typedef struct {
+    mat2d_t matrices[GFX_MAX_MATRICES];
+    mat2d_t matrix;
+    uint32_t index;
+} MatrixStack;
+
+typedef struct {
+    vec2_t position;
+    vec2_t texCoord;
+    uint32_t color;
+} TextureColorVertex;
+
+typedef struct {
+    vec2_t position;
+    uint32_t color;
+} PointVertex;
+
+/*
+ Quads are 4 vertices drawn through the shared quad index buffer, so a quad batch is a range of indices.
+ Instance batches are a range of the instance buffer, expanded by the backend's vertex stage under transform.
+*/
+typedef struct {
+    TextureID texture;
+    uint32_t type;
+    uint32_t count;
+    uint32_t offset;
+    mat2d_t transform;
+} DrawBatch;
+
+typedef struct {
+    DrawBatch* pBuffer;
+    uint32_t count;
+} DrawBatchBuffer;
+
+typedef struct {
+    TextureColorVertex* pBuffer;
+    uint32_t count;
+} TextureColorVertexBuffer;
+
+typedef struct {
+    SpriteInstance* pBuffer;
+    uint32_t count;
+} SpriteInstanceBuffer;
+
+typedef struct {
+    MatrixStack matrixStack;
+    DrawBatchBuffer batchBuffer;
+    TextureColorVertexBuffer vertices;
+    SpriteInstanceBuffer instances;
+    uint16_t* pQuadIndices;
+    DrawBatch* pCurrentBatch;
+    TextureID currentTexture;
+    TextureID whiteTexture;
+    PointVertex pendingPoint;
+    bool32_t hasPendingPoint;
+    uint32_t pipelineID;
+    bool32_t hasInstancing;
+    /* Deferred sorting, the texture slot of a key indexes pSortTextures. */
+    uint64_t* pQuadKeys;
+    uint64_t* pSortKeys;
+    uint16_t* pSortOrder;
+    TextureColorVertex* pSortVertices;
+    TextureID* pSortTextures;
+    uint32_t sortTextureCount;
+    uint64_t sortStateKey;
+    uint32_t sortLayer;
+    uint32_t sortDepthBits;
+    bool32_t isDeferred;
+#if GFX_ENABLE_STATS
+    GfxFrameStats frameStats;
+    GfxFrameStats lastFrameStats;
+#endif
+} GfxBatchState;
+
+extern GfxBatchState gGfxBatch;
+
+#if GFX_ENABLE_STATS
+#define GFX_STATS_ADD(counter, value) (gGfxBatch.frameStats.counter += (value))
+#else
+#define GFX_STATS_ADD(counter, value) ((void)0)
+#endif
+
+/*
+ Creates the white texel through gfx_create_texture, so the backend must be able to create textures first.
+ Backends that expand SpriteInstance on the GPU call _gfx_batch_set_instancing with UT_TRUE after _gfx_batch_initialize.
+*/
+void _gfx_batch_initialize(void);
+void _gfx_batch_set_instancing(bool32_t enabled);
+void _gfx_batch_shutdown(void);
+void _gfx_batch_reset(void);
+void _gfx_batch_sort(void);
+/* Backends call this at the end of gfx_end so gfx_get_frame_stats reports the finished frame. */
+void _gfx_batch_end_frame(void);
+
+#endif
@@ -8,6 +8,56 @@
 #endif 
 
 #include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ Instruction set of the batch kernels, picked at compile time from the target flags.
+ Define MATH_SIMD to MATH_SIMD_NONE to force the scalar path, for example to compare against it.
+*/
+#define MATH_SIMD_NONE 0
+#define MATH_SIMD_SSE2 1
+#define MATH_SIMD_AVX2 2
+#define MATH_SIMD_NEON 3
+
+#ifndef MATH_SIMD
+#if defined(__AVX2__)
+#define MATH_SIMD MATH_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD MATH_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#define MATH_SIMD MATH_SIMD_NEON
+#else
+#define MATH_SIMD MATH_SIMD_NONE
+#endif
+#endif
+
+#if MATH_SIMD == MATH_SIMD_AVX2
+#include <immintrin.h>
+#elif MATH_SIMD == MATH_SIMD_SSE2
+#include <emmintrin.h>
+#elif MATH_SIMD == MATH_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+/*
+ Two adjacent floats moved as one 64 bit lane. Casting the float pointer to double* breaks
+ strict aliasing, once inlined the compiler may hoist the load above the float stores that
+ wrote the matrix. memcpy is legal and still compiles to a single movsd.
+*/
+static inline double mathLoadPair(const float* pPair)
+{
+    double pair;
+    memcpy(&pair, pPair, sizeof(pair));
+    return pair;
+}
+static inline void mathStorePair(float* pPair, __m128 value)
+{
+    double pair = _mm_cvtsd_f64(_mm_castps_pd(value));
+    memcpy(pPair, &pair, sizeof(pair));
+}
+#endif
 
 #define MPI 3.141592653589793f
 
@@ -20,6 +70,166 @@ static float degToRad(float deg)
     return deg * MPI / 180.0f;
 }
 
+/*
+ Sine and cosine together, within 1e-7 of the exact values for |radian| below 2 pi and 1e-6 up to
+ MATH_SINCOS_MAX_RADIAN. The argument is reduced around the nearest multiple of pi/2 in three parts
+ (Cody and Waite), so the reduction is exact in that range, then the Cephes minimax polynomials
+ cover [-pi/4, pi/4]. Larger and non-finite arguments fall back to sinf and cosf.
+ sinCosBatch runs the same operations in the same order on every instruction set. Its results
+ match sinCos bit for bit unless the compiler contracts the scalar code into FMAs (GCC does by
+ default outside strict ISO C modes), then they can differ by 6e-8, one ulp of the result.
+ -ffast-math reassociates the reduction and drops the NaN checks, none of this holds under it.
+*/
+#define MATH_SINCOS_MAX_RADIAN 65536.0f
+#define MATH_2_OVER_PI 0.636619772367581343f
+#define MATH_PIO2_1 1.5703125f
+#define MATH_PIO2_2 4.83751296997070312e-4f
+#define MATH_PIO2_3 7.54978995489188216e-8f
+#define MATH_SIN_1 -1.6666654611e-1f
+#define MATH_SIN_2 8.3321608736e-3f
+#define MATH_SIN_3 -1.9515295891e-4f
+#define MATH_COS_1 4.166664568298827e-2f
+#define MATH_COS_2 -1.388731625493765e-3f
+#define MATH_COS_3 2.443315711809948e-5f
+
+static void sinCos(float radian, float* pOutSin, float* pOutCos)
+{
+    /* Also catches NaN. Past the bound the quadrant would overflow its int32_t conversion. */
+    if (!(fabsf(radian) <= MATH_SINCOS_MAX_RADIAN))
+    {
+        *pOutSin = sinf(radian);
+        *pOutCos = cosf(radian);
+        return;
+    }
+    float scaled = radian * MATH_2_OVER_PI;
+    int32_t quadrant = (int32_t)(scaled + copysignf(0.5f, scaled));
+    float q = (float)quadrant;
+    float r = ((radian - q * MATH_PIO2_1) - q * MATH_PIO2_2) - q * MATH_PIO2_3;
+    float r2 = r * r;
+    float sn = r + r * r2 * (MATH_SIN_1 + r2 * (MATH_SIN_2 + r2 * MATH_SIN_3));
+    float cs = 1.0f - 0.5f * r2 + r2 * r2 * (MATH_COS_1 + r2 * (MATH_COS_2 + r2 * MATH_COS_3));
+    /* Branch free, the quadrants of neighbouring calls are rarely predictable. */
+    union { float f; uint32_t u; } values[2], outSin, outCos;
+    values[0].f = sn;
+    values[1].f = cs;
+    outSin.u = values[quadrant & 1].u ^ ((uint32_t)(quadrant & 2) << 30);
+    outCos.u = values[(quadrant & 1) ^ 1].u ^ ((uint32_t)((quadrant + 1) & 2) << 30);
+    *pOutSin = outSin.f;
+    *pOutCos = outCos.f;
+}
+static void sinCosBatch(float* pOutSin, float* pOutCos, float* pRadians, uint32_t count)
+{
+    uint32_t index = 0;
+#if MATH_SIMD == MATH_SIMD_AVX2
+    {
+        __m256 signMask = _mm256_set1_ps(-0.0f), half = _mm256_set1_ps(0.5f), one = _mm256_set1_ps(1.0f);
+        __m256i quadrantOne = _mm256_set1_epi32(1), quadrantTwo = _mm256_set1_epi32(2);
+        for (; index + 8 <= count; index += 8)
+        {
+            __m256 x = _mm256_loadu_ps(&pRadians[index]);
+            __m256 scaled = _mm256_mul_ps(x, _mm256_set1_ps(MATH_2_OVER_PI));
+            __m256i quadrant = _mm256_cvttps_epi32(_mm256_add_ps(scaled, _mm256_or_ps(_mm256_and_ps(scaled, signMask), half)));
+            __m256 q = _mm256_cvtepi32_ps(quadrant);
+            __m256 r = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(x, _mm256_mul_ps(q, _mm256_set1_ps(MATH_PIO2_1))),
+                                                   _mm256_mul_ps(q, _mm256_set1_ps(MATH_PIO2_2))), _mm256_mul_ps(q, _mm256_set1_ps(MATH_PIO2_3)));
+            __m256 r2 = _mm256_mul_ps(r, r);
+            __m256 sinPoly = _mm256_add_ps(_mm256_set1_ps(MATH_SIN_2), _mm256_mul_ps(r2, _mm256_set1_ps(MATH_SIN_3)));
+            sinPoly = _mm256_add_ps(_mm256_set1_ps(MATH_SIN_1), _mm256_mul_ps(r2, sinPoly));
+            __m256 sn = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2), sinPoly));
+            __m256 cosPoly = _mm256_add_ps(_mm256_set1_ps(MATH_COS_2), _mm256_mul_ps(r2, _mm256_set1_ps(MATH_COS_3)));
+            cosPoly = _mm256_add_ps(_mm256_set1_ps(MATH_COS_1), _mm256_mul_ps(r2, cosPoly));
+            __m256 cs = _mm256_add_ps(_mm256_sub_ps(one, _mm256_mul_ps(half, r2)), _mm256_mul_ps(_mm256_mul_ps(r2, r2), cosPoly));
+            __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, quadrantOne), quadrantOne));
+            __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, quadrantTwo), 30));
+            __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, quadrantOne), quadrantTwo), 30));
+            _mm256_storeu_ps(&pOutSin[index], _mm256_xor_ps(_mm256_blendv_ps(sn, cs, swap), sinSign));
+            _mm256_storeu_ps(&pOutCos[index], _mm256_xor_ps(_mm256_blendv_ps(cs, sn, swap), cosSign));
+            int32_t outside = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, x), _mm256_set1_ps(MATH_SINCOS_MAX_RADIAN), _CMP_NLE_UQ));
+            for (uint32_t lane = 0; outside != 0; ++lane, outside >>= 1)
+            {
+                if (outside & 1) sinCos(pRadians[index + lane], &pOutSin[index + lane], &pOutCos[index + lane]);
+            }
+        }
+    }
+#endif
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    {
+        __m128 signMask = _mm_set1_ps(-0.0f), half = _mm_set1_ps(0.5f), one = _mm_set1_ps(1.0f);
+        __m128i quadrantOne = _mm_set1_epi32(1), quadrantTwo = _mm_set1_epi32(2);
+        for (; index + 4 <= count; index += 4)
+        {
+            __m128 x = _mm_loadu_ps(&pRadians[index]);
+            __m128 scaled = _mm_mul_ps(x, _mm_set1_ps(MATH_2_OVER_PI));
+            __m128i quadrant = _mm_cvttps_epi32(_mm_add_ps(scaled, _mm_or_ps(_mm_and_ps(scaled, signMask), half)));
+            __m128 q = _mm_cvtepi32_ps(quadrant);
+            __m128 r = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(q, _mm_set1_ps(MATH_PIO2_1))),
+                                             _mm_mul_ps(q, _mm_set1_ps(MATH_PIO2_2))), _mm_mul_ps(q, _mm_set1_ps(MATH_PIO2_3)));
+            __m128 r2 = _mm_mul_ps(r, r);
+            __m128 sinPoly = _mm_add_ps(_mm_set1_ps(MATH_SIN_2), _mm_mul_ps(r2, _mm_set1_ps(MATH_SIN_3)));
+            sinPoly = _mm_add_ps(_mm_set1_ps(MATH_SIN_1), _mm_mul_ps(r2, sinPoly));
+            __m128 sn = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sinPoly));
+            __m128 cosPoly = _mm_add_ps(_mm_set1_ps(MATH_COS_2), _mm_mul_ps(r2, _mm_set1_ps(MATH_COS_3)));
+            cosPoly = _mm_add_ps(_mm_set1_ps(MATH_COS_1), _mm_mul_ps(r2, cosPoly));
+            __m128 cs = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), cosPoly));
+            /* Odd quadrants swap sine and cosine, the sign bits come straight from bit 1 of the quadrant. */
+            __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, quadrantOne), quadrantOne));
+            __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, quadrantTwo), 30));
+            __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, quadrantOne), quadrantTwo), 30));
+            _mm_storeu_ps(&pOutSin[index], _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, cs), _mm_andnot_ps(swap, sn)), sinSign));
+            _mm_storeu_ps(&pOutCos[index], _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, sn), _mm_andnot_ps(swap, cs)), cosSign));
+            /* Out of range and non-finite lanes are rare, they are redone by the scalar fallback. */
+            int32_t outside = _mm_movemask_ps(_mm_cmpnle_ps(_mm_andnot_ps(signMask, x), _mm_set1_ps(MATH_SINCOS_MAX_RADIAN)));
+            for (uint32_t lane = 0; outside != 0; ++lane, outside >>= 1)
+            {
+                if (outside & 1) sinCos(pRadians[index + lane], &pOutSin[index + lane], &pOutCos[index + lane]);
+            }
+        }
+    }
+#elif MATH_SIMD == MATH_SIMD_NEON
+    {
+        uint32x4_t signMask = vdupq_n_u32(0x80000000);
+        float32x4_t half = vdupq_n_f32(0.5f), one = vdupq_n_f32(1.0f);
+        int32x4_t quadrantOne = vdupq_n_s32(1), quadrantTwo = vdupq_n_s32(2);
+        for (; index + 4 <= count; index += 4)
+        {
+            float32x4_t x = vld1q_f32(&pRadians[index]);
+            float32x4_t scaled = vmulq_f32(x, vdupq_n_f32(MATH_2_OVER_PI));
+            float32x4_t roundHalf = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(scaled), signMask), vreinterpretq_u32_f32(half)));
+            int32x4_t quadrant = vcvtq_s32_f32(vaddq_f32(scaled, roundHalf));
+            float32x4_t q = vcvtq_f32_s32(quadrant);
+            float32x4_t r = vsubq_f32(vsubq_f32(vsubq_f32(x, vmulq_f32(q, vdupq_n_f32(MATH_PIO2_1))),
+                                                vmulq_f32(q, vdupq_n_f32(MATH_PIO2_2))), vmulq_f32(q, vdupq_n_f32(MATH_PIO2_3)));
+            float32x4_t r2 = vmulq_f32(r, r);
+            float32x4_t sinPoly = vaddq_f32(vdupq_n_f32(MATH_SIN_2), vmulq_f32(r2, vdupq_n_f32(MATH_SIN_3)));
+            sinPoly = vaddq_f32(vdupq_n_f32(MATH_SIN_1), vmulq_f32(r2, sinPoly));
+            float32x4_t sn = vaddq_f32(r, vmulq_f32(vmulq_f32(r, r2), sinPoly));
+            float32x4_t cosPoly = vaddq_f32(vdupq_n_f32(MATH_COS_2), vmulq_f32(r2, vdupq_n_f32(MATH_COS_3)));
+            cosPoly = vaddq_f32(vdupq_n_f32(MATH_COS_1), vmulq_f32(r2, cosPoly));
+            float32x4_t cs = vaddq_f32(vsubq_f32(one, vmulq_f32(half, r2)), vmulq_f32(vmulq_f32(r2, r2), cosPoly));
+            uint32x4_t swap = vceqq_s32(vandq_s32(quadrant, quadrantOne), quadrantOne);
+            uint32x4_t sinSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(quadrant, quadrantTwo), 30));
+            uint32x4_t cosSign = vreinterpretq_u32_s32(vshlq_n_s32(vandq_s32(vaddq_s32(quadrant, quadrantOne), quadrantTwo), 30));
+            vst1q_f32(&pOutSin[index], vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, cs, sn)), sinSign)));
+            vst1q_f32(&pOutCos[index], vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, sn, cs)), cosSign)));
+            uint32x4_t inside = vcleq_f32(vabsq_f32(x), vdupq_n_f32(MATH_SINCOS_MAX_RADIAN));
+            uint32x2_t inside2 = vand_u32(vget_low_u32(inside), vget_high_u32(inside));
+            if ((vget_lane_u32(inside2, 0) & vget_lane_u32(inside2, 1)) == 0)
+            {
+                for (uint32_t lane = 0; lane < 4; ++lane)
+                {
+                    float radian = pRadians[index + lane];
+                    if (!(fabsf(radian) <= MATH_SINCOS_MAX_RADIAN)) sinCos(radian, &pOutSin[index + lane], &pOutCos[index + lane]);
+                }
+            }
+        }
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        sinCos(pRadians[index], &pOutSin[index], &pOutCos[index]);
+    }
+}
+
 struct quat
 {
     float x, y, z, w;
@@ -44,6 +254,13 @@ struct vec3
     };
 };
 
+/* A rotation as the unit complex number (cos, sin). */
+struct rot2
+{
+    float c;
+    float s;
+};
+
 struct mat2d
 {
     union
@@ -79,6 +296,16 @@ static struct vec2* mat2DVec2Mul(struct vec2*  __restrict pOut, struct mat2d* __
 static struct mat2d* mat2DTranslate(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float x, float y);
 static struct mat2d* mat2DScale(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float x, float y);
 static struct mat2d* mat2DRotate(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float radian);
+static struct mat2d* mat2DRotateSinCos(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float sn, float cs);
+/*
+ Batch kernels. pOut may be the input array, every element is read before it is written.
+ mat2dMulBatch applies pM1 after each of the count matrices in pM0, so pOut[i] = pM0[i] * pM1.
+ The SoA variant works on separate x and y arrays, which vectorizes best on every instruction set.
+ They pay off on whole arrays, for a handful of points like a quad's corners mat2DVec2Mul is faster.
+*/
+static struct mat2d* mat2dMulBatch(struct mat2d* pOut, struct mat2d* pM0, struct mat2d* __restrict pM1, uint32_t count);
+static struct vec2* mat2DVec2MulBatch(struct vec2* pOut, struct mat2d* __restrict pM0, struct vec2* pV1, uint32_t count);
+static void mat2DVec2MulBatchSoA(float* pOutX, float* pOutY, struct mat2d* __restrict pM0, float* pX, float* pY, uint32_t count);
 
 /* mat4 */
 static struct mat4* mat4Ident(struct mat4* __restrict pOut);
@@ -97,6 +324,17 @@ static struct mat4* mat4Perspective(struct mat4* __restrict pOut, float fovY, fl
 static struct mat4* mat4Orthographic(struct mat4* __restrict pOut, float left, float right, float bottom, float top, float orthoNear, float orthoFar);
 static struct mat4* mat4LookAt(struct mat4* __restrict pOut, struct vec3* __restrict pEye, struct vec3* __restrict pCenter, struct vec3* __restrict pUp);
 
+/*
+ rot2
+ A sprite that turns by a fixed step every frame keeps a rot2 and advances it by the step's rot2,
+ which costs a complex multiply instead of a sine and cosine. rot2Advance renormalizes as it goes,
+ so the length stays within float rounding of 1 no matter how many steps are taken.
+*/
+static struct rot2* rot2Set(struct rot2* __restrict pOut, float radian);
+static struct rot2* rot2Mul(struct rot2* __restrict pOut, struct rot2* __restrict pR0, struct rot2* __restrict pR1);
+static struct rot2* rot2Advance(struct rot2* __restrict pR, struct rot2* __restrict pStep);
+static float rot2Angle(struct rot2* __restrict pR);
+
 /* vec2 */
 static struct vec2* vec2Add(struct vec2* __restrict pOut, struct vec2* __restrict pV0, struct vec2* __restrict pV1);
 static struct vec2* vec2Sub(struct vec2* __restrict pOut, struct vec2* __restrict pV0, struct vec2* __restrict pV1);
@@ -146,6 +384,7 @@ typedef struct quat quat_t;
 typedef struct vec2 vec2_t;
 typedef struct vec3 vec3_t;
 typedef struct mat2d mat2d_t;
+typedef struct rot2 rot2_t;
 typedef struct mat4 mat4_t;
 
 /* mat2d */
@@ -210,14 +449,183 @@ struct mat2d* mat2DScale(struct mat2d* __restrict pOut, struct mat2d* __restrict
 }
 struct mat2d* mat2DRotate(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float radian)
 {
-    float sn = sinf(radian);
-    float cs = cosf(radian);
+    float sn, cs;
+    sinCos(radian, &sn, &cs);
+    return mat2DRotateSinCos(pOut, pM, sn, cs);
+}
+struct mat2d* mat2DRotateSinCos(struct mat2d* __restrict pOut, struct mat2d* __restrict pM, float sn, float cs)
+{
     pOut->data[0] = cs * pM->data[0] + sn * pM->data[2];
     pOut->data[1] = cs * pM->data[1] + sn * pM->data[3];
     pOut->data[2] = -sn * pM->data[0] + cs * pM->data[2];
     pOut->data[3] = -sn * pM->data[1] + cs * pM->data[3];
     return pOut;
 }
+struct mat2d* mat2dMulBatch(struct mat2d* pOut, struct mat2d* pM0, struct mat2d* __restrict pM1, uint32_t count)
+{
+    uint32_t index = 0;
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    /* (a, b, c, d) = (a, a, c, c) * (a1, b1, a1, b1) + (b, b, d, d) * (c1, d1, c1, d1) */
+    __m128 rowX = _mm_castpd_ps(_mm_set1_pd(mathLoadPair(&pM1->data[0])));
+    __m128 rowY = _mm_castpd_ps(_mm_set1_pd(mathLoadPair(&pM1->data[2])));
+    __m128 translation = _mm_castpd_ps(_mm_set_sd(mathLoadPair(&pM1->data[4])));
+    for (; index < count; ++index)
+    {
+        __m128 linear = _mm_loadu_ps(pM0[index].data);
+        __m128 offset = _mm_castpd_ps(_mm_set_sd(mathLoadPair(&pM0[index].data[4])));
+        __m128 outLinear = _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(linear, linear, _MM_SHUFFLE(2, 2, 0, 0)), rowX),
+                                      _mm_mul_ps(_mm_shuffle_ps(linear, linear, _MM_SHUFFLE(3, 3, 1, 1)), rowY));
+        __m128 outOffset = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(offset, offset, _MM_SHUFFLE(0, 0, 0, 0)), rowX),
+                                                 _mm_mul_ps(_mm_shuffle_ps(offset, offset, _MM_SHUFFLE(1, 1, 1, 1)), rowY)), translation);
+        _mm_storeu_ps(pOut[index].data, outLinear);
+        mathStorePair(&pOut[index].data[4], outOffset);
+    }
+#elif MATH_SIMD == MATH_SIMD_NEON
+    float32x2_t rowX = vld1_f32(&pM1->data[0]);
+    float32x2_t rowY = vld1_f32(&pM1->data[2]);
+    float32x2_t translation = vld1_f32(&pM1->data[4]);
+    for (; index < count; ++index)
+    {
+        float32x2_t r0 = vld1_f32(&pM0[index].data[0]);
+        float32x2_t r1 = vld1_f32(&pM0[index].data[2]);
+        float32x2_t r2 = vld1_f32(&pM0[index].data[4]);
+        float32x2_t out0 = vmla_lane_f32(vmul_lane_f32(rowX, r0, 0), rowY, r0, 1);
+        float32x2_t out1 = vmla_lane_f32(vmul_lane_f32(rowX, r1, 0), rowY, r1, 1);
+        float32x2_t out2 = vmla_lane_f32(vmla_lane_f32(translation, rowX, r2, 0), rowY, r2, 1);
+        vst1_f32(&pOut[index].data[0], out0);
+        vst1_f32(&pOut[index].data[2], out1);
+        vst1_f32(&pOut[index].data[4], out2);
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        struct mat2d m0 = pM0[index];
+        mat2dMul(&pOut[index], &m0, pM1);
+    }
+    return pOut;
+}
+struct vec2* mat2DVec2MulBatch(struct vec2* pOut, struct mat2d* __restrict pM0, struct vec2* pV1, uint32_t count)
+{
+    uint32_t index = 0;
+#if MATH_SIMD == MATH_SIMD_AVX2
+    /* Four interleaved points per register: (x, y) = x * (a, b) + y * (c, d) + (tx, ty) */
+    __m256 colX8 = _mm256_castpd_ps(_mm256_set1_pd(mathLoadPair(&pM0->data[0])));
+    __m256 colY8 = _mm256_castpd_ps(_mm256_set1_pd(mathLoadPair(&pM0->data[2])));
+    __m256 translation8 = _mm256_castpd_ps(_mm256_set1_pd(mathLoadPair(&pM0->data[4])));
+    for (; index + 4 <= count; index += 4)
+    {
+        __m256 points = _mm256_loadu_ps(&pV1[index].x);
+        __m256 xs = _mm256_moveldup_ps(points);
+        __m256 ys = _mm256_movehdup_ps(points);
+        _mm256_storeu_ps(&pOut[index].x, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xs, colX8), _mm256_mul_ps(ys, colY8)), translation8));
+    }
+#endif
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    /* Each pair of matrix elements is broadcast as one 64 bit lane. */
+    __m128 colX = _mm_castpd_ps(_mm_set1_pd(mathLoadPair(&pM0->data[0])));
+    __m128 colY = _mm_castpd_ps(_mm_set1_pd(mathLoadPair(&pM0->data[2])));
+    __m128 translation = _mm_castpd_ps(_mm_set1_pd(mathLoadPair(&pM0->data[4])));
+    for (; index + 2 <= count; index += 2)
+    {
+        __m128 points = _mm_loadu_ps(&pV1[index].x);
+        __m128 xs = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+        __m128 ys = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+        _mm_storeu_ps(&pOut[index].x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, colX), _mm_mul_ps(ys, colY)), translation));
+    }
+#elif MATH_SIMD == MATH_SIMD_NEON
+    float32x4_t a = vdupq_n_f32(pM0->a), b = vdupq_n_f32(pM0->b);
+    float32x4_t c = vdupq_n_f32(pM0->c), d = vdupq_n_f32(pM0->d);
+    float32x4_t tx = vdupq_n_f32(pM0->tx), ty = vdupq_n_f32(pM0->ty);
+    for (; index + 4 <= count; index += 4)
+    {
+        /* vld2 splits four interleaved points into x and y lanes, vst2 interleaves them back. */
+        float32x4x2_t points = vld2q_f32(&pV1[index].x);
+        float32x4x2_t result;
+        result.val[0] = vmlaq_f32(vmlaq_f32(tx, points.val[0], a), points.val[1], c);
+        result.val[1] = vmlaq_f32(vmlaq_f32(ty, points.val[0], b), points.val[1], d);
+        vst2q_f32(&pOut[index].x, result);
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        struct vec2 point = pV1[index];
+        mat2DVec2Mul(&pOut[index], pM0, &point);
+    }
+    return pOut;
+}
+void mat2DVec2MulBatchSoA(float* pOutX, float* pOutY, struct mat2d* __restrict pM0, float* pX, float* pY, uint32_t count)
+{
+    uint32_t index = 0;
+#if MATH_SIMD == MATH_SIMD_AVX2
+    __m256 a8 = _mm256_set1_ps(pM0->a), b8 = _mm256_set1_ps(pM0->b);
+    __m256 c8 = _mm256_set1_ps(pM0->c), d8 = _mm256_set1_ps(pM0->d);
+    __m256 tx8 = _mm256_set1_ps(pM0->tx), ty8 = _mm256_set1_ps(pM0->ty);
+    for (; index + 8 <= count; index += 8)
+    {
+        __m256 x = _mm256_loadu_ps(&pX[index]);
+        __m256 y = _mm256_loadu_ps(&pY[index]);
+        _mm256_storeu_ps(&pOutX[index], _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, a8), _mm256_mul_ps(y, c8)), tx8));
+        _mm256_storeu_ps(&pOutY[index], _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, b8), _mm256_mul_ps(y, d8)), ty8));
+    }
+#endif
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    __m128 a = _mm_set1_ps(pM0->a), b = _mm_set1_ps(pM0->b);
+    __m128 c = _mm_set1_ps(pM0->c), d = _mm_set1_ps(pM0->d);
+    __m128 tx = _mm_set1_ps(pM0->tx), ty = _mm_set1_ps(pM0->ty);
+    for (; index + 4 <= count; index += 4)
+    {
+        __m128 x = _mm_loadu_ps(&pX[index]);
+        __m128 y = _mm_loadu_ps(&pY[index]);
+        _mm_storeu_ps(&pOutX[index], _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a), _mm_mul_ps(y, c)), tx));
+        _mm_storeu_ps(&pOutY[index], _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, b), _mm_mul_ps(y, d)), ty));
+    }
+#elif MATH_SIMD == MATH_SIMD_NEON
+    float32x4_t a = vdupq_n_f32(pM0->a), b = vdupq_n_f32(pM0->b);
+    float32x4_t c = vdupq_n_f32(pM0->c), d = vdupq_n_f32(pM0->d);
+    float32x4_t tx = vdupq_n_f32(pM0->tx), ty = vdupq_n_f32(pM0->ty);
+    for (; index + 4 <= count; index += 4)
+    {
+        float32x4_t x = vld1q_f32(&pX[index]);
+        float32x4_t y = vld1q_f32(&pY[index]);
+        vst1q_f32(&pOutX[index], vmlaq_f32(vmlaq_f32(tx, x, a), y, c));
+        vst1q_f32(&pOutY[index], vmlaq_f32(vmlaq_f32(ty, x, b), y, d));
+    }
+#endif
+    for (; index < count; ++index)
+    {
+        float x = pX[index];
+        float y = pY[index];
+        pOutX[index] = x * pM0->a + y * pM0->c + pM0->tx;
+        pOutY[index] = x * pM0->b + y * pM0->d + pM0->ty;
+    }
+}
+
+/* rot2 */
+struct rot2* rot2Set(struct rot2* __restrict pOut, float radian)
+{
+    sinCos(radian, &pOut->s, &pOut->c);
+    return pOut;
+}
+struct rot2* rot2Mul(struct rot2* __restrict pOut, struct rot2* __restrict pR0, struct rot2* __restrict pR1)
+{
+    pOut->c = pR0->c * pR1->c - pR0->s * pR1->s;
+    pOut->s = pR0->s * pR1->c + pR0->c * pR1->s;
+    return pOut;
+}
+struct rot2* rot2Advance(struct rot2* __restrict pR, struct rot2* __restrict pStep)
+{
+    float c = pR->c * pStep->c - pR->s * pStep->s;
+    float s = pR->s * pStep->c + pR->c * pStep->s;
+    /* One Newton step towards 1 / length, the length is already within rounding of 1. */
+    float scale = 1.5f - 0.5f * (c * c + s * s);
+    pR->c = c * scale;
+    pR->s = s * scale;
+    return pR;
+}
+float rot2Angle(struct rot2* __restrict pR)
+{
+    return atan2f(pR->s, pR->c);
+}
 
 /* mat4 */
 struct mat4* mat4Ident(struct mat4* __restrict pOut)
@@ -242,6 +650,50 @@ struct mat4* mat4Ident(struct mat4* __restrict pOut)
 }
 struct mat4* mat4Mul(struct mat4* __restrict pOut, struct mat4* __restrict pM0, struct mat4* __restrict pM1)
 {
+    /* Every row of the result is the rows of pM0 weighted by the matching row of pM1, summed in the scalar order. */
+#if MATH_SIMD == MATH_SIMD_AVX2
+    __m256 row0 = _mm256_broadcast_ps((const __m128*)&pM0->data[0]);
+    __m256 row1 = _mm256_broadcast_ps((const __m128*)&pM0->data[4]);
+    __m256 row2 = _mm256_broadcast_ps((const __m128*)&pM0->data[8]);
+    __m256 row3 = _mm256_broadcast_ps((const __m128*)&pM0->data[12]);
+    for (uint32_t index = 0; index < 16; index += 8)
+    {
+        __m256 weights = _mm256_loadu_ps(&pM1->data[index]);
+        __m256 result = _mm256_mul_ps(_mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+        result = _mm256_add_ps(result, _mm256_mul_ps(_mm256_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+        _mm256_storeu_ps(&pOut->data[index], result);
+    }
+#elif MATH_SIMD == MATH_SIMD_SSE2
+    __m128 row0 = _mm_loadu_ps(&pM0->data[0]);
+    __m128 row1 = _mm_loadu_ps(&pM0->data[4]);
+    __m128 row2 = _mm_loadu_ps(&pM0->data[8]);
+    __m128 row3 = _mm_loadu_ps(&pM0->data[12]);
+    for (uint32_t index = 0; index < 16; index += 4)
+    {
+        __m128 weights = _mm_loadu_ps(&pM1->data[index]);
+        __m128 result = _mm_mul_ps(_mm_shuffle_ps(weights, weights, _MM_SHUFFLE(0, 0, 0, 0)), row0);
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(weights, weights, _MM_SHUFFLE(1, 1, 1, 1)), row1));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(weights, weights, _MM_SHUFFLE(2, 2, 2, 2)), row2));
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(weights, weights, _MM_SHUFFLE(3, 3, 3, 3)), row3));
+        _mm_storeu_ps(&pOut->data[index], result);
+    }
+#elif MATH_SIMD == MATH_SIMD_NEON
+    float32x4_t row0 = vld1q_f32(&pM0->data[0]);
+    float32x4_t row1 = vld1q_f32(&pM0->data[4]);
+    float32x4_t row2 = vld1q_f32(&pM0->data[8]);
+    float32x4_t row3 = vld1q_f32(&pM0->data[12]);
+    for (uint32_t index = 0; index < 16; index += 4)
+    {
+        float32x4_t weights = vld1q_f32(&pM1->data[index]);
+        float32x4_t result = vmulq_lane_f32(row0, vget_low_f32(weights), 0);
+        result = vaddq_f32(result, vmulq_lane_f32(row1, vget_low_f32(weights), 1));
+        result = vaddq_f32(result, vmulq_lane_f32(row2, vget_high_f32(weights), 0));
+        result = vaddq_f32(result, vmulq_lane_f32(row3, vget_high_f32(weights), 1));
+        vst1q_f32(&pOut->data[index], result);
+    }
+#else
     pOut->data[0] = pM1->data[0] * pM0->data[0] + pM1->data[1] * pM0->data[4] + pM1->data[2] * pM0->data[8] + pM1->data[3] * pM0->data[12];
     pOut->data[1] = pM1->data[0] * pM0->data[1] + pM1->data[1] * pM0->data[5] + pM1->data[2] * pM0->data[9] + pM1->data[3] * pM0->data[13];
     pOut->data[2] = pM1->data[0] * pM0->data[2] + pM1->data[1] * pM0->data[6] + pM1->data[2] * pM0->data[10] + pM1->data[3] * pM0->data[14];
@@ -258,6 +710,7 @@ struct mat4* mat4Mul(struct mat4* __restrict pOut, struct mat4* __restrict pM0,
     pOut->data[13] = pM1->data[12] * pM0->data[1] + pM1->data[13] * pM0->data[5] + pM1->data[14] * pM0->data[9] + pM1->data[15] * pM0->data[13];
     pOut->data[14] = pM1->data[12] * pM0->data[2] + pM1->data[13] * pM0->data[6] + pM1->data[14] * pM0->data[10] + pM1->data[15] * pM0->data[14];
     pOut->data[15] = pM1->data[12] * pM0->data[3] + pM1->data[13] * pM0->data[7] + pM1->data[14] * pM0->data[11] + pM1->data[15] * pM0->data[15];
+#endif
     return pOut;
 }
 struct vec3* mat4Vec3Mul(struct vec3* __restrict pOut, struct mat4* __restrict pM0, struct vec3* __restrict pV1)
@@ -289,6 +742,65 @@ struct mat4* mat4Transpose(struct mat4* __restrict pOut, struct mat4* __restrict
 }
 struct mat4* mat4Invert(struct mat4* __restrict pOut, struct mat4* __restrict pM)
 {
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    /*
+     Block inverse on the 2x2 sub-matrices A B / C D, each held in one register as (m00, m01, m10, m11).
+     With # the adjugate, M^-1 = 1/|M| * (X# Y# / Z# W#) and
+       X = |D| A - B (D# C), W = |A| D - C (A# B), Y = |B| C - D (A# B)#, Z = |C| B - A (D# C)#,
+       |M| = |A| |D| + |B| |C| - tr((A# B) (D# C)).
+     The inverse of the transpose is the transpose of the inverse, so the storage order doesn't matter.
+    */
+    __m128 row0 = _mm_loadu_ps(&pM->data[0]);
+    __m128 row1 = _mm_loadu_ps(&pM->data[4]);
+    __m128 row2 = _mm_loadu_ps(&pM->data[8]);
+    __m128 row3 = _mm_loadu_ps(&pM->data[12]);
+    __m128 a = _mm_movelh_ps(row0, row1);
+    __m128 b = _mm_movehl_ps(row1, row0);
+    __m128 c = _mm_movelh_ps(row2, row3);
+    __m128 d = _mm_movehl_ps(row3, row2);
+    /* (|A|, |B|, |C|, |D|) */
+    __m128 subDeterminants = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+                                        _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+    __m128 detA = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 detB = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 detC = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 detD = _mm_shuffle_ps(subDeterminants, subDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+    /* D# C and A# B */
+    __m128 dc = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(0, 0, 3, 3)), c),
+                           _mm_mul_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 0, 3, 2))));
+    __m128 ab = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                           _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+    /* B (D# C) and C (A# B) */
+    __m128 bdc = _mm_add_ps(_mm_mul_ps(b, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 0, 3, 0))),
+                            _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(1, 2, 1, 2))));
+    __m128 cab = _mm_add_ps(_mm_mul_ps(c, _mm_shuffle_ps(ab, ab, _MM_SHUFFLE(3, 0, 3, 0))),
+                            _mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(ab, ab, _MM_SHUFFLE(1, 2, 1, 2))));
+    /* D (A# B)# and A (D# C)# */
+    __m128 dab = _mm_sub_ps(_mm_mul_ps(d, _mm_shuffle_ps(ab, ab, _MM_SHUFFLE(0, 3, 0, 3))),
+                            _mm_mul_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(ab, ab, _MM_SHUFFLE(1, 2, 1, 2))));
+    __m128 adc = _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(0, 3, 0, 3))),
+                            _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(1, 2, 1, 2))));
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), bdc);
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), cab);
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), dab);
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), adc);
+    __m128 trace = _mm_mul_ps(ab, _mm_shuffle_ps(dc, dc, _MM_SHUFFLE(3, 1, 2, 0)));
+    trace = _mm_add_ps(trace, _mm_movehl_ps(trace, trace));
+    trace = _mm_add_ss(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 1, 1, 1)));
+    __m128 determinant = _mm_sub_ss(_mm_add_ss(_mm_mul_ss(detA, detD), _mm_mul_ss(detB, detC)), trace);
+    if (_mm_cvtss_f32(determinant) == 0.0f) return pM;
+    /* The adjugate's signs are folded into the reciprocal, its transposes into the final shuffles. */
+    __m128 reciprocal = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(0, 0, 0, 0)));
+    x = _mm_mul_ps(x, reciprocal);
+    y = _mm_mul_ps(y, reciprocal);
+    z = _mm_mul_ps(z, reciprocal);
+    w = _mm_mul_ps(w, reciprocal);
+    _mm_storeu_ps(&pOut->data[0], _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&pOut->data[4], _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+    _mm_storeu_ps(&pOut->data[8], _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+    _mm_storeu_ps(&pOut->data[12], _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+    return pOut;
+#else
     float d0 = pM->data[0] * pM->data[5] - pM->data[1] * pM->data[4];
     float d1 = pM->data[0] * pM->data[6] - pM->data[2] * pM->data[4];
     float d2 = pM->data[0] * pM->data[7] - pM->data[3] * pM->data[4];
@@ -323,6 +835,7 @@ struct mat4* mat4Invert(struct mat4* __restrict pOut, struct mat4* __restrict pM
     pOut->data[14] = (pM->data[13] * d1 - pM->data[12] * d3 - pM->data[14] * d0) * determinant;
     pOut->data[15] = (pM->data[8] * d3 - pM->data[9] * d1 + pM->data[10] * d0) * determinant;
     return pOut;
+#endif
 }
 struct mat4* mat4RotateX(struct mat4* __restrict pOut, struct mat4* __restrict pM, float radian)
 {
@@ -517,6 +1030,17 @@ struct mat4* mat4Perspective(struct mat4* __restrict pOut, float fovY, float asp
 }
 struct mat4* mat4Orthographic(struct mat4* __restrict pOut, float left, float right, float bottom, float top, float orthoNear, float orthoFar)
 {
+#if MATH_SIMD == MATH_SIMD_SSE2 || MATH_SIMD == MATH_SIMD_AVX2
+    /* One division for the three reciprocals, then each row is a masked lane of the scale or the translation. */
+    __m128 reciprocals = _mm_div_ps(_mm_set1_ps(1.0f), _mm_setr_ps(left - right, bottom - top, orthoNear - orthoFar, 1.0f));
+    __m128 scale = _mm_mul_ps(_mm_setr_ps(-2.0f, -2.0f, 2.0f, 0.0f), reciprocals);
+    __m128 translation = _mm_mul_ps(_mm_setr_ps(left + right, top + bottom, orthoFar + orthoNear, 1.0f), reciprocals);
+    _mm_storeu_ps(&pOut->data[0], _mm_and_ps(scale, _mm_castsi128_ps(_mm_setr_epi32(-1, 0, 0, 0))));
+    _mm_storeu_ps(&pOut->data[4], _mm_and_ps(scale, _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, 0))));
+    _mm_storeu_ps(&pOut->data[8], _mm_and_ps(scale, _mm_castsi128_ps(_mm_setr_epi32(0, 0, -1, 0))));
+    _mm_storeu_ps(&pOut->data[12], translation);
+    return pOut;
+#else
     float leftRight = 1.0f / (left - right);
     float bottomTop = 1.0f / (bottom - top);
     float nearFar = 1.0f / (orthoNear - orthoFar);
@@ -537,6 +1061,7 @@ struct mat4* mat4Orthographic(struct mat4* __restrict pOut, float left, float ri
     pOut->data[14] = (orthoFar + orthoNear) * nearFar;
     pOut->data[15] = 1.0f;
     return pOut;
+#endif
 }
 struct mat4* mat4LookAt(struct mat4* __restrict pOut, struct vec3* __restrict pEye, struct vec3* __restrict pCenter, struct vec3* __restrict pUp)
 {
@@ -1,82 +1,308 @@
 #include "memory.h"
 #include "utils.h"
 #include "assert.h"
+#include "atomic.h"
+#include "memory_trace.h"
+#include "../config/config_mem.h"
 #include <string.h>
 
 #define MEM_TO_CHUNK(mem) (FreelistChunkInfo*)((FreelistChunkInfo*)mem - 1)
 #define CHUNK_TO_MEM(chunk) (void*)((FreelistChunkInfo*)chunk + 1)
 
+/*
+ Pool sizes are consecutive powers of two, so the size class of an allocation is the bit
+ position of its rounded size. Every pool owns a fixed-stride region of one reserved
+ range, so the owner of a pointer is its offset from the range divided by the stride.
+*/
+#if MEM_POOL_MIN_SIZE_SHIFT < 3 || MEM_POOL_MAX_SIZE_SHIFT < MEM_POOL_MIN_SIZE_SHIFT
+#error "Pool classes must start at 8 bytes or more and end at or after the first class"
+#endif
+#define POOL_MIN_SIZE_SHIFT MEM_POOL_MIN_SIZE_SHIFT
+#define POOL_COUNT (MEM_POOL_MAX_SIZE_SHIFT - MEM_POOL_MIN_SIZE_SHIFT + 1)
+#define POOL_SIZE(index) ((size_t)1 << (POOL_MIN_SIZE_SHIFT + (index)))
+#if defined(MEM_POOL_INITIAL_COMMIT)
+static const size_t kPoolInitialCommit[POOL_COUNT] = MEM_POOL_INITIAL_COMMIT;
+#endif
+
+/*
+ Regions are only reserved address space. A pool commits pages in granules as its bump
+ pointer advances, so a region's size is just the most a single class can ever grow to.
+ MEM_POOL_REGION_SHIFT (see config_mem.h) sizes it per platform.
+*/
+#define POOL_REGION_SHIFT MEM_POOL_REGION_SHIFT
+#define POOL_REGION_SIZE ((size_t)1 << POOL_REGION_SHIFT)
+#if (MEM_POOL_PAGE_FLAGS) & (MEM_PAGE_HUGE | MEM_PAGE_HUGE_EXPLICIT)
+#define POOL_COMMIT_GRANULE ((size_t)UT_MB(2))
+#else
+#define POOL_COMMIT_GRANULE ((size_t)UT_KB(64))
+#endif
+
+/*
+ Each thread caches free blocks of every size class in a magazine and only touches the
+ shared pool when it runs empty or full. The pool keeps freed blocks as a lock-free stack
+ of batches, linked by block index (plus one, so 0 ends a list). Links live in the free
+ blocks themselves, which is why the smallest block is 8 bytes. The stack head packs a
+ 32 bit tag above the index of its first block and the tag changes on every update, so a
+ compare and swap can't succeed against a head that was popped and pushed back (ABA).
+*/
+#define POOL_MAGAZINE_CAPACITY 64
+#define POOL_MAGAZINE_BATCH (POOL_MAGAZINE_CAPACITY / 2)
+#define POOL_STACK_TAG_SHIFT 32
+
+/* Accounting size classes are the pools followed by the heap. */
+#define MEM_SIZE_CLASS_COUNT (POOL_COUNT + 1)
+#define MEM_TAG_STACK_CAPACITY 16
+#define MEM_TRACK_TAGS (MEM_ENABLE_ACCOUNTING || MEM_ENABLE_TRACE)
+#define MEM_TRACE_BUFFER_CAPACITY 4096
+
+/*
+ Two level segregated fit heap for the blocks the pools don't cover. Free blocks are binned
+ by the highest bit of their size and the HEAP_SL_LOG2 bits below it, with a bitmap per
+ level, so finding a fitting bin and every split or merge are O(1). Blocks sit back to
+ back in one reserved region that is committed as the heap grows. Free neighbours are
+ always merged, and a zero sized used block closes the committed range.
+*/
+#define HEAP_SL_LOG2 5
+#define HEAP_SL_COUNT (1 << HEAP_SL_LOG2)
 #if MEM_DEFAULT_ALIGNMENT == 4
-#define POOL_COUNT 9
-static size_t kPoolSizes[POOL_COUNT] = { 4, 8, 16, 32, 64, 128, 256, 512, 1024 };
-static uint32_t kPoolCapacities[POOL_COUNT] = { UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(2), UT_MB(4), UT_MB(8), UT_MB(16) };
+#define HEAP_ALIGN_LOG2 3
 #else
-#define POOL_COUNT 8
-static size_t kPoolSizes[POOL_COUNT] = { 8, 16, 32, 64, 128, 256, 512, 1024 };
-static uint32_t kPoolCapacities[POOL_COUNT] = { UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(2), UT_MB(4), UT_MB(8), UT_MB(16) };
+#define HEAP_ALIGN_LOG2 4
+#endif
+#define HEAP_REGION_SHIFT MEM_HEAP_REGION_SHIFT
+#if HEAP_REGION_SHIFT < HEAP_ALIGN_LOG2 + HEAP_SL_LOG2 + 1 || HEAP_REGION_SHIFT > 32
+#error "The heap region must be between twice the smallest bin and 4GB"
+#endif
+#define HEAP_ALIGNMENT ((size_t)1 << HEAP_ALIGN_LOG2)
+#define HEAP_REGION_SIZE ((size_t)1 << HEAP_REGION_SHIFT)
+#define HEAP_FL_SHIFT (HEAP_SL_LOG2 + HEAP_ALIGN_LOG2)
+#define HEAP_FL_COUNT (HEAP_REGION_SHIFT - HEAP_FL_SHIFT + 1)
+#define HEAP_SMALL_BLOCK_SIZE ((size_t)1 << HEAP_FL_SHIFT)
+#define HEAP_BLOCK_FREE ((size_t)1)
+#define HEAP_BLOCK_HEADER_SIZE UT_OFFSETOF(MemHeapBlock, pNextFree)
+#if (MEM_HEAP_PAGE_FLAGS) & (MEM_PAGE_HUGE | MEM_PAGE_HUGE_EXPLICIT)
+#define HEAP_COMMIT_GRANULE ((size_t)UT_MB(2))
+#else
+#define HEAP_COMMIT_GRANULE ((size_t)UT_MB(1))
 #endif
 
 static const size_t kMemLinearContextCapacity = UT_MB(16);
 
 typedef struct {
-    PageAllocation pageAlloc;
-    void** pAddresses;
-    size_t capacity;
-    size_t count;
-} MemAddrStack;
+    uint32_t next;
+    uint32_t nextBatch;
+} MemPoolLink;
 
 typedef struct {
-    MemAddrStack freeStack;
-    PageAllocation pageAlloc;
     void* pHead;
-    void* pCurr;
     size_t elementSize;
-    size_t usedByteSize;
+    uint32_t elementShift;
+    uint32_t capacity;
+    volatile uint64_t freeBatches;
+    volatile uint64_t bumpCount;
+    volatile uint64_t committedByteSize;
+    volatile uint64_t usedByteSize;
+#if MEM_ENABLE_ACCOUNTING
+    /* Tag of every block, so frees are charged back to whoever allocated. */
+    PageAllocation tagAlloc;
+    uint8_t* pTags;
+#endif
 } MemPool;
 
 typedef struct {
+    PageAllocation pageAlloc;
     MemPool pools[POOL_COUNT];
 } MemPoolContext;
 
+typedef struct {
+    void* pBlocks[POOL_MAGAZINE_CAPACITY];
+    uint32_t count;
+} MemPoolMagazine;
+
+/* Size holds the payload bytes with HEAP_BLOCK_FREE in the low bit. The free links overlap the payload. */
+typedef struct _MemHeapBlock {
+    struct _MemHeapBlock* pPrevPhysical;
+    size_t size;
+#if MEM_ENABLE_ACCOUNTING
+    /* Padded so the header stays a multiple of HEAP_ALIGNMENT. */
+    size_t tag;
+    size_t padding;
+#endif
+    struct _MemHeapBlock* pNextFree;
+    struct _MemHeapBlock* pPrevFree;
+} MemHeapBlock;
+
+typedef struct {
+    MemLinearContext context;
+    uint64_t frameIndex;
+    volatile uint64_t retiredFrameIndex;
+} MemFrameArena;
+
+typedef struct {
+    PageAllocation pageAlloc;
+    MemHeapBlock* pFreeLists[HEAP_FL_COUNT][HEAP_SL_COUNT];
+    uint32_t slBitmaps[HEAP_FL_COUNT];
+    uint32_t flBitmap;
+    MemHeapBlock* pSentinel;
+    size_t committedByteSize;
+    size_t usedByteSize;
+    volatile uint32_t lock;
+} MemHeapContext;
+
 static MemLinearContext gMemLinearContext = { 0 };
 static MemPoolContext gMemPoolContext = { 0 };
+static MemHeapContext gMemHeapContext = { 0 };
+static MemFrameArena gMemFrameArenas[MEM_FRAME_ARENA_COUNT] = { 0 };
+static uint64_t gMemFrameIndex = 0;
+#if MEM_TRACK_TAGS
+static ATOM_THREAD_LOCAL uint8_t gMemTagStack[MEM_TAG_STACK_CAPACITY];
+static ATOM_THREAD_LOCAL uint32_t gMemTagStackCount = 0;
+#endif
+#if MEM_ENABLE_ACCOUNTING
+static MemStats gMemTagStats[MEM_TAG_COUNT] = { 0 };
+static MemStats gMemSizeClassStats[MEM_SIZE_CLASS_COUNT] = { 0 };
+static const char* kMemTagNames[MEM_TAG_COUNT] = { "untagged", "gfx", "textures", "assets", "game" };
+#endif
+#if MEM_ENABLE_TRACE
+typedef struct {
+    FILE* pFile;
+    MemTraceRecord records[MEM_TRACE_BUFFER_CAPACITY];
+    uint32_t count;
+    volatile uint32_t enabled;
+    volatile uint32_t lock;
+} MemTraceContext;
+
+static MemTraceContext gMemTrace = { 0 };
+#endif
 static MemLinearContext* pCurrentLinearContext = NULL;
+static ATOM_THREAD_LOCAL MemPoolMagazine gPoolMagazines[POOL_COUNT];
+
+static bool32_t _pool_commit(MemPool* pPool, uint64_t byteSize);
+
+#if MEM_TRACK_TAGS
+static uint8_t _current_tag(void) {
+    return gMemTagStackCount > 0 ? gMemTagStack[gMemTagStackCount - 1] : (uint8_t)MEM_TAG_UNTAGGED;
+}
+#endif
+
+#if MEM_ENABLE_TRACE
+static void _trace_flush(void) {
+    if (gMemTrace.count > 0) fwrite(gMemTrace.records, sizeof(MemTraceRecord), gMemTrace.count, gMemTrace.pFile);
+    gMemTrace.count = 0;
+}
 
-void mem_initialize(void) {
-    DBG_ASSERT(mem_page_alloc(kMemLinearContextCapacity, &gMemLinearContext.pageAlloc), "Failed to allocate virtual memory for scratch buffer");
+static void _trace(MemTraceOp op, const void* pAddress, size_t size) {
+    if (!atom_load_u32(&gMemTrace.enabled)) return;
+    MemTraceRecord record = { 0 };
+    record.address = (uint64_t)UT_POINTER_TO_UINT(pAddress);
+    record.frame = (uint32_t)gMemFrameIndex;
+    record.size = (uint32_t)size;
+    record.op = (uint8_t)op;
+    record.tag = _current_tag();
+    atom_spin_lock(&gMemTrace.lock);
+    if (gMemTrace.pFile != NULL) {
+        if (gMemTrace.count == MEM_TRACE_BUFFER_CAPACITY) _trace_flush();
+        gMemTrace.records[gMemTrace.count++] = record;
+    }
+    atom_spin_unlock(&gMemTrace.lock);
+}
+#define MEM_TRACE(op, pAddress, size) _trace(op, pAddress, size)
+#else
+#define MEM_TRACE(op, pAddress, size) ((void)0)
+#endif
+
+/* Failures unwind through mem_shutdown, freeing the still zeroed allocations is a no-op on every backend. */
+bool32_t mem_initialize(void) {
+    if (!mem_page_alloc_flags(kMemLinearContextCapacity, MEM_LINEAR_PAGE_FLAGS, &gMemLinearContext.pageAlloc)) {
+        DBG_ASSERT(0, "Failed to allocate virtual memory for scratch buffer");
+        mem_shutdown();
+        return UT_FALSE;
+    }
     gMemLinearContext.pHead = gMemLinearContext.pageAlloc.pAddress;
     gMemLinearContext.pCurr = gMemLinearContext.pHead;
     gMemLinearContext.usedByteSize = 0;
+
+    for (uint32_t index = 0; index < MEM_FRAME_ARENA_COUNT; ++index) {
+        MemLinearContext* pContext = &gMemFrameArenas[index].context;
+        if (!mem_page_alloc_flags(MEM_FRAME_ARENA_CAPACITY, MEM_LINEAR_PAGE_FLAGS, &pContext->pageAlloc)) {
+            DBG_ASSERT(0, "Failed to allocate virtual memory for frame arena %u", index);
+            mem_shutdown();
+            return UT_FALSE;
+        }
+        pContext->pHead = pContext->pageAlloc.pAddress;
+        pContext->pCurr = pContext->pHead;
+    }
+    gMemFrameIndex = 0;
     
+    if (!mem_page_reserve(POOL_REGION_SIZE * POOL_COUNT, MEM_POOL_PAGE_FLAGS, &gMemPoolContext.pageAlloc)) {
+        DBG_ASSERT(0, "Failed to reserve %zu bytes of virtual memory for the pools", POOL_REGION_SIZE * POOL_COUNT);
+        mem_shutdown();
+        return UT_FALSE;
+    }
     for (uint32_t index = 0; index < POOL_COUNT; ++index) {
         MemPool* pPool = &gMemPoolContext.pools[index];
-        size_t elementSize = kPoolSizes[index];
-        size_t poolCapacity = kPoolCapacities[index];
-        size_t stackCapacity = poolCapacity / elementSize;
-        size_t stackByteSize = stackCapacity * sizeof(void*);
+        size_t elementSize = POOL_SIZE(index);
         pPool->elementSize = elementSize;
+        pPool->elementShift = POOL_MIN_SIZE_SHIFT + index;
+        pPool->capacity = (uint32_t)(POOL_REGION_SIZE / elementSize);
+        pPool->freeBatches = 0;
+        pPool->bumpCount = 0;
+        pPool->committedByteSize = 0;
         pPool->usedByteSize = 0;
-        pPool->freeStack.count = 0;
-        pPool->freeStack.capacity = stackCapacity;
-        DBG_ASSERT(mem_page_alloc(poolCapacity, &pPool->pageAlloc), "Failed to allocate virtual memory for pool of size %zu", elementSize);
-        DBG_ASSERT(mem_page_alloc(stackByteSize, &pPool->freeStack.pageAlloc), "Failed to allocate virtual memory for pool's free stack of size %zu", elementSize);
-        pPool->freeStack.pAddresses = (void**)pPool->freeStack.pageAlloc.pAddress;
-        pPool->pHead = pPool->pageAlloc.pAddress;
-        pPool->pCurr = pPool->pHead;
+        pPool->pHead = UT_FORWARD_POINTER(gMemPoolContext.pageAlloc.pAddress, index * POOL_REGION_SIZE);
+#if MEM_ENABLE_ACCOUNTING
+        if (!mem_page_alloc(pPool->capacity, &pPool->tagAlloc)) {
+            DBG_ASSERT(0, "Failed to allocate the tag map for pool of size %zu", elementSize);
+            mem_shutdown();
+            return UT_FALSE;
+        }
+        pPool->pTags = (uint8_t*)pPool->tagAlloc.pAddress;
+#endif
+#if defined(MEM_POOL_INITIAL_COMMIT)
+        bool32_t result = _pool_commit(pPool, UT_MIN((uint64_t)kPoolInitialCommit[index], (uint64_t)POOL_REGION_SIZE));
+        DBG_ASSERT(result, "Failed to commit the initial pages of pool of size %zu", elementSize);
+        UT_UNUSED(result);
+#endif
+    }
+
+    if (!mem_page_reserve(HEAP_REGION_SIZE, MEM_HEAP_PAGE_FLAGS, &gMemHeapContext.pageAlloc) ||
+        !mem_page_commit(&gMemHeapContext.pageAlloc, 0, HEAP_BLOCK_HEADER_SIZE)) {
+        DBG_ASSERT(0, "Failed to reserve %zu bytes of virtual memory for the heap", HEAP_REGION_SIZE);
+        mem_shutdown();
+        return UT_FALSE;
     }
+    gMemHeapContext.pSentinel = (MemHeapBlock*)gMemHeapContext.pageAlloc.pAddress;
+    gMemHeapContext.pSentinel->pPrevPhysical = NULL;
+    gMemHeapContext.pSentinel->size = 0;
+    gMemHeapContext.committedByteSize = HEAP_BLOCK_HEADER_SIZE;
     
     mem_linear_set_default_context();
+    return UT_TRUE;
 }
 
 void mem_shutdown(void) {
-    mem_page_free(&pCurrentLinearContext->pageAlloc);
+    mem_trace_end();
+    mem_page_free(&gMemLinearContext.pageAlloc);
     memset(&gMemLinearContext, 0, sizeof(gMemLinearContext));
 
+    for (uint32_t index = 0; index < MEM_FRAME_ARENA_COUNT; ++index) {
+        mem_page_free(&gMemFrameArenas[index].context.pageAlloc);
+    }
+    memset(gMemFrameArenas, 0, sizeof(gMemFrameArenas));
+
+#if MEM_ENABLE_ACCOUNTING
     for (uint32_t index = 0; index < POOL_COUNT; ++index) {
-        MemPool* pPool = &gMemPoolContext.pools[index];
-        mem_page_free(&pPool->pageAlloc);
+        mem_page_free(&gMemPoolContext.pools[index].tagAlloc);
     }
+    memset(gMemTagStats, 0, sizeof(gMemTagStats));
+    memset(gMemSizeClassStats, 0, sizeof(gMemSizeClassStats));
+#endif
+    mem_page_free(&gMemPoolContext.pageAlloc);
     memset(&gMemPoolContext, 0, sizeof(MemPoolContext));
+    memset(gPoolMagazines, 0, sizeof(gPoolMagazines));
+
+    mem_page_free(&gMemHeapContext.pageAlloc);
+    memset(&gMemHeapContext, 0, sizeof(MemHeapContext));
 }
 
 void mem_linear_set_context(MemLinearContext* pContext) {
@@ -87,13 +313,15 @@ void mem_linear_set_default_context(void) {
     pCurrentLinearContext = &gMemLinearContext;
 }
 
-void* mem_linear_alloc(size_t size, uint32_t alignment) {
-    DBG_ASSERT(size < kMemLinearContextCapacity, "Can't allocate a buffer bigger than the scratch capacity.");
+static void* _linear_alloc(MemLinearContext* pContext, size_t size, uint32_t alignment) {
+    DBG_ASSERT(size < pContext->pageAlloc.size, "Can't allocate a buffer bigger than the scratch capacity.");
     alignment = alignment < MEM_DEFAULT_ALIGNMENT ? MEM_DEFAULT_ALIGNMENT : alignment;
-    void* p = UT_ALIGN_POINTER(pCurrentLinearContext->pCurr, alignment);
-    if (UT_IN_RANGE(UT_FORWARD_POINTER(p, size), pCurrentLinearContext->pHead, UT_FORWARD_POINTER(pCurrentLinearContext->pHead, kMemLinearContextCapacity))) {
-        pCurrentLinearContext->pCurr = UT_FORWARD_POINTER(p, size);
-        pCurrentLinearContext->usedByteSize += size;
+    void* p = UT_ALIGN_POINTER(pContext->pCurr, alignment);
+    if (UT_IN_RANGE(UT_FORWARD_POINTER(p, size), pContext->pHead, UT_FORWARD_POINTER(pContext->pHead, pContext->pageAlloc.size))) {
+        pContext->pCurr = UT_FORWARD_POINTER(p, size);
+        pContext->usedByteSize += size;
+        pContext->peakByteSize = UT_MAX(pContext->peakByteSize, pContext->usedByteSize);
+        MEM_TRACE(MEM_TRACE_LINEAR_ALLOC, pContext, size);
 #if defined(_DEBUG)
         memset(p, 0xAA, size);
 #endif
@@ -102,71 +330,642 @@ void* mem_linear_alloc(size_t size, uint32_t alignment) {
     return NULL;
 }
 
+static void _linear_reset(MemLinearContext* pContext) {
+#if defined(_DEBUG)
+    if (pContext->usedByteSize > 0)
+        memset(pContext->pHead, 0xDD, pContext->usedByteSize);
+#endif
+    DBG_ASSERT(pContext->scopeCount == 0, "Resetting a linear context with %u scopes still pushed", pContext->scopeCount);
+    pContext->usedByteSize = 0;
+    pContext->pCurr = pContext->pHead;
+    MEM_TRACE(MEM_TRACE_LINEAR_RESET, pContext, 0);
+}
+
+void* mem_linear_alloc(size_t size, uint32_t alignment) {
+    return _linear_alloc(pCurrentLinearContext, size, alignment);
+}
+
 void mem_linear_reset() {
+    _linear_reset(pCurrentLinearContext);
+}
+
+MemLinearMarker mem_linear_get_marker(void) {
+    MemLinearMarker marker;
+    marker.pCurr = pCurrentLinearContext->pCurr;
+    marker.usedByteSize = pCurrentLinearContext->usedByteSize;
+    return marker;
+}
+
+void mem_linear_free_to_marker(MemLinearMarker marker) {
+    DBG_ASSERT(UT_IN_RANGE(UT_POINTER_TO_UINT(marker.pCurr), UT_POINTER_TO_UINT(pCurrentLinearContext->pHead), UT_POINTER_TO_UINT(pCurrentLinearContext->pCurr)), "Marker doesn't belong to the live part of the current linear context");
 #if defined(_DEBUG)
-    if (pCurrentLinearContext->usedByteSize > 0)
-        memset(pCurrentLinearContext->pHead, 0xDD, pCurrentLinearContext->usedByteSize);
+    memset(marker.pCurr, 0xDD, UT_POINTER_TO_UINT(pCurrentLinearContext->pCurr) - UT_POINTER_TO_UINT(marker.pCurr));
 #endif
-    pCurrentLinearContext->usedByteSize = 0;
-    pCurrentLinearContext->pCurr = pCurrentLinearContext->pHead;
+    pCurrentLinearContext->pCurr = marker.pCurr;
+    pCurrentLinearContext->usedByteSize = marker.usedByteSize;
+    MEM_TRACE(MEM_TRACE_LINEAR_RESET, pCurrentLinearContext, marker.usedByteSize);
+}
+
+void mem_linear_push_scope(void) {
+    DBG_ASSERT(pCurrentLinearContext->scopeCount < MEM_LINEAR_MAX_SCOPES, "Linear scopes nested deeper than %u", MEM_LINEAR_MAX_SCOPES);
+    pCurrentLinearContext->scopes[pCurrentLinearContext->scopeCount++] = mem_linear_get_marker();
+}
+
+void mem_linear_pop_scope(void) {
+    DBG_ASSERT(pCurrentLinearContext->scopeCount > 0, "Popping a linear scope that was never pushed");
+    mem_linear_free_to_marker(pCurrentLinearContext->scopes[--pCurrentLinearContext->scopeCount]);
 }
 
 size_t mem_linear_used_size(void) {
     return pCurrentLinearContext->usedByteSize;
 }
 
+size_t mem_linear_peak_size(void) {
+    return pCurrentLinearContext->peakByteSize;
+}
+
+uint64_t mem_frame_begin(void) {
+    uint64_t frameIndex = ++gMemFrameIndex;
+    MemFrameArena* pArena = &gMemFrameArenas[frameIndex % MEM_FRAME_ARENA_COUNT];
+    /* Only spins when the consumer runs more than MEM_FRAME_ARENA_COUNT - 1 frames behind. */
+    while (atom_load_u64(&pArena->retiredFrameIndex) != pArena->frameIndex) atom_cpu_relax();
+    _linear_reset(&pArena->context);
+    pArena->frameIndex = frameIndex;
+#if MEM_ENABLE_ACCOUNTING
+    for (uint32_t index = 0; index < MEM_TAG_COUNT; ++index) {
+        atom_store_u64(&gMemTagStats[index].framePeakByteSize, atom_load_u64(&gMemTagStats[index].currentByteSize));
+    }
+    for (uint32_t index = 0; index < MEM_SIZE_CLASS_COUNT; ++index) {
+        atom_store_u64(&gMemSizeClassStats[index].framePeakByteSize, atom_load_u64(&gMemSizeClassStats[index].currentByteSize));
+    }
+#endif
+    return frameIndex;
+}
+
+void mem_frame_retire(uint64_t frameIndex) {
+    MemFrameArena* pArena = &gMemFrameArenas[frameIndex % MEM_FRAME_ARENA_COUNT];
+    atom_store_u64(&pArena->retiredFrameIndex, frameIndex);
+}
+
+void* mem_frame_alloc(size_t size, uint32_t alignment) {
+    return _linear_alloc(mem_frame_context(), size, alignment);
+}
+
+MemLinearContext* mem_frame_context(void) {
+    DBG_ASSERT(gMemFrameIndex > 0, "No frame has begun yet");
+    return &gMemFrameArenas[gMemFrameIndex % MEM_FRAME_ARENA_COUNT].context;
+}
+
+#if MEM_ENABLE_ACCOUNTING
+static void _stats_raise(volatile uint64_t* pPeak, uint64_t value) {
+    uint64_t peak = atom_load_u64(pPeak);
+    while (value > peak && !atom_cas_u64(pPeak, peak, value)) peak = atom_load_u64(pPeak);
+}
+
+static void _stats_add(MemStats* pStats, uint64_t size) {
+    uint64_t current = atom_fetch_add_u64(&pStats->currentByteSize, size) + size;
+    _stats_raise(&pStats->peakByteSize, current);
+    _stats_raise(&pStats->framePeakByteSize, current);
+    atom_fetch_add_u64(&pStats->currentCount, 1);
+    atom_fetch_add_u64(&pStats->totalCount, 1);
+}
+
+static void _stats_sub(MemStats* pStats, uint64_t size) {
+    atom_fetch_add_u64(&pStats->currentByteSize, (uint64_t)0 - size);
+    atom_fetch_add_u64(&pStats->currentCount, (uint64_t)0 - 1);
+}
+
+static void _account_alloc(uint32_t sizeClass, uint8_t tag, uint64_t size) {
+    _stats_add(&gMemTagStats[tag], size);
+    _stats_add(&gMemSizeClassStats[sizeClass], size);
+}
+
+static void _account_free(uint32_t sizeClass, uint8_t tag, uint64_t size) {
+    _stats_sub(&gMemTagStats[tag], size);
+    _stats_sub(&gMemSizeClassStats[sizeClass], size);
+}
+#endif
+
+static uint32_t _pool_block_index(const MemPool* pPool, const void* p) {
+    return (uint32_t)((UT_POINTER_TO_UINT(p) - UT_POINTER_TO_UINT(pPool->pHead)) >> pPool->elementShift) + 1;
+}
+
+static void* _pool_block_address(const MemPool* pPool, uint32_t block) {
+    return UT_FORWARD_POINTER(pPool->pHead, ((size_t)(block - 1) << pPool->elementShift));
+}
+
+static MemPoolLink* _pool_link(const MemPool* pPool, uint32_t block) {
+    return (MemPoolLink*)_pool_block_address(pPool, block);
+}
+
+static uint64_t _pool_stack_head(uint64_t previousHead, uint32_t block) {
+    return (((previousHead >> POOL_STACK_TAG_SHIFT) + 1) << POOL_STACK_TAG_SHIFT) | block;
+}
+
+static void _pool_push_batch(MemPool* pPool, void** ppBlocks, uint32_t count) {
+    uint32_t first = _pool_block_index(pPool, ppBlocks[0]);
+    uint32_t last = first;
+    for (uint32_t index = 1; index < count; ++index) {
+        uint32_t block = _pool_block_index(pPool, ppBlocks[index]);
+        _pool_link(pPool, last)->next = block;
+        last = block;
+    }
+    _pool_link(pPool, last)->next = 0;
+    uint64_t head = atom_load_u64(&pPool->freeBatches);
+    for (;;) {
+        atom_store_u32(&_pool_link(pPool, first)->nextBatch, (uint32_t)head);
+        if (atom_cas_u64(&pPool->freeBatches, head, _pool_stack_head(head, first))) break;
+        head = atom_load_u64(&pPool->freeBatches);
+    }
+}
+
+static uint32_t _pool_pop_batch(MemPool* pPool, MemPoolMagazine* pMagazine) {
+    uint64_t head = atom_load_u64(&pPool->freeBatches);
+    for (;;) {
+        uint32_t first = (uint32_t)head;
+        if (first == 0) return 0;
+        /*
+         May read the link of a block another thread already took and is writing to. Only
+         mem_pool_trim decommits pages, so the read is harmless and the tag then fails the swap.
+        */
+        uint32_t nextBatch = atom_load_u32(&_pool_link(pPool, first)->nextBatch);
+        if (atom_cas_u64(&pPool->freeBatches, head, _pool_stack_head(head, nextBatch))) break;
+        head = atom_load_u64(&pPool->freeBatches);
+    }
+    uint32_t count = 0;
+    for (uint32_t block = (uint32_t)head; block != 0; block = _pool_link(pPool, block)->next) {
+        pMagazine->pBlocks[count++] = _pool_block_address(pPool, block);
+    }
+    return count;
+}
+
+/* Threads racing to grow may commit the same granules twice, which is harmless. */
+static bool32_t _pool_commit(MemPool* pPool, uint64_t byteSize) {
+    uint64_t committed = atom_load_u64(&pPool->committedByteSize);
+    if (byteSize <= committed) return UT_TRUE;
+    uint64_t end = UT_MIN(((byteSize + POOL_COMMIT_GRANULE - 1) & ~(uint64_t)(POOL_COMMIT_GRANULE - 1)), (uint64_t)POOL_REGION_SIZE);
+    size_t offset = UT_POINTER_TO_UINT(pPool->pHead) - UT_POINTER_TO_UINT(gMemPoolContext.pageAlloc.pAddress);
+    if (!mem_page_commit(&gMemPoolContext.pageAlloc, offset + (size_t)committed, (size_t)(end - committed))) return UT_FALSE;
+#if (MEM_POOL_PAGE_FLAGS) & MEM_PAGE_PREFAULT
+    /* Reservations are never prefaulted by the backend, so touch the committed pages here. */
+    memset(UT_FORWARD_POINTER(pPool->pHead, (size_t)committed), 0, (size_t)(end - committed));
+#endif
+    while (committed < end && !atom_cas_u64(&pPool->committedByteSize, committed, end)) {
+        committed = atom_load_u64(&pPool->committedByteSize);
+    }
+    return UT_TRUE;
+}
+
+static uint32_t _pool_bump_batch(MemPool* pPool, MemPoolMagazine* pMagazine) {
+    uint64_t start = atom_fetch_add_u64(&pPool->bumpCount, POOL_MAGAZINE_BATCH);
+    if (start >= pPool->capacity) return 0;
+    uint32_t count = (uint32_t)UT_MIN((uint64_t)POOL_MAGAZINE_BATCH, pPool->capacity - start);
+    if (!_pool_commit(pPool, (start + count) << pPool->elementShift)) return 0;
+    /* Magazines pop from the top, so lay the batch out backwards to hand out ascending addresses. */
+    for (uint32_t index = 0; index < count; ++index) {
+        pMagazine->pBlocks[index] = _pool_block_address(pPool, (uint32_t)start + count - index);
+    }
+    return count;
+}
+
+static bool32_t _pool_refill(MemPool* pPool, MemPoolMagazine* pMagazine) {
+    uint32_t count = _pool_pop_batch(pPool, pMagazine);
+    if (count == 0) count = _pool_bump_batch(pPool, pMagazine);
+    if (count == 0) return UT_FALSE;
+    pMagazine->count = count;
+    atom_fetch_add_u64(&pPool->usedByteSize, (uint64_t)count << pPool->elementShift);
+    return UT_TRUE;
+}
+
+static void _pool_drain(MemPool* pPool, MemPoolMagazine* pMagazine, uint32_t count) {
+    pMagazine->count -= count;
+    _pool_push_batch(pPool, &pMagazine->pBlocks[pMagazine->count], count);
+    atom_fetch_add_u64(&pPool->usedByteSize, (uint64_t)0 - ((uint64_t)count << pPool->elementShift));
+}
+
 void* mem_pool_alloc(size_t size) {
-    if (size < kPoolSizes[0]) size = kPoolSizes[0];
-    UT_ROUND_POT(size);
-    if (size <= kPoolSizes[POOL_COUNT - 1]) {
-        uint32_t poolIndex = 0;
-        if (size < kPoolSizes[POOL_COUNT / 2]) {
-            for (poolIndex = 0; poolIndex < POOL_COUNT; ++poolIndex) {
-                if (size == kPoolSizes[poolIndex]) break;
-            }
-        } else {
-            for (poolIndex = POOL_COUNT - 1; poolIndex >= 0; --poolIndex) {
-                if (size == kPoolSizes[poolIndex]) break;
-            }
-        }
-        MemPool* pPool = &gMemPoolContext.pools[poolIndex];
-        if (pPool->freeStack.count > 0) {
-            void* pFreeAddress = pPool->freeStack.pAddresses[--pPool->freeStack.count];
-            return pFreeAddress;
-        }
-        void* pNewAddress = pPool->pCurr;
-        void* pNextAddress = UT_FORWARD_POINTER(pNewAddress, size);
-        if (UT_IN_RANGE(pNextAddress, pPool->pHead, UT_FORWARD_POINTER(pPool->pHead, pPool->pageAlloc.size))) {
-            pPool->pCurr = pNextAddress;
-            pPool->usedByteSize += size;
+    if (size > POOL_SIZE(POOL_COUNT - 1)) return NULL;
+    size_t requestedSize = size;
+    if (size < POOL_SIZE(0)) size = POOL_SIZE(0);
+    uint32_t poolIndex = UT_BIT_SCAN_REVERSE(size - 1) + 1 - POOL_MIN_SIZE_SHIFT;
+    MemPoolMagazine* pMagazine = &gPoolMagazines[poolIndex];
+    if (pMagazine->count == 0 && !_pool_refill(&gMemPoolContext.pools[poolIndex], pMagazine)) return NULL;
+    void* pAddress = pMagazine->pBlocks[--pMagazine->count];
+#if MEM_ENABLE_ACCOUNTING
+    MemPool* pPool = &gMemPoolContext.pools[poolIndex];
+    uint8_t tag = _current_tag();
+    pPool->pTags[_pool_block_index(pPool, pAddress) - 1] = tag;
+    _account_alloc(poolIndex, tag, pPool->elementSize);
+#endif
+    MEM_TRACE(MEM_TRACE_POOL_ALLOC, pAddress, requestedSize);
+    UT_UNUSED(requestedSize);
 #if defined(_DEBUG)
-            memset(pNewAddress, 0xAA, size);
+    memset(pAddress, 0xAA, POOL_SIZE(poolIndex));
 #endif
-            return pNewAddress;
-        }
-    }
-    return NULL;
+    return pAddress;
 }
+
 void mem_pool_free(void* p) {
-    for (uint32_t index = 0; index < POOL_COUNT; ++index) {
-        MemPool* pPool = &gMemPoolContext.pools[index];
-        void* pHead = pPool->pHead;
-        if (UT_IN_RANGE(p, pHead, UT_FORWARD_POINTER(pHead, pPool->pageAlloc.size))) {
-            pPool->freeStack.pAddresses[pPool->freeStack.count++] = p;
-            pPool->usedByteSize -= pPool->elementSize;
+    size_t poolIndex = (UT_POINTER_TO_UINT(p) - UT_POINTER_TO_UINT(gMemPoolContext.pageAlloc.pAddress)) >> POOL_REGION_SHIFT;
+    DBG_ASSERT(poolIndex < POOL_COUNT, "Trying de free memory that doesn't belong to any pool on the current context");
+    MemPool* pPool = &gMemPoolContext.pools[poolIndex];
+    DBG_ASSERT(_pool_block_index(pPool, p) <= atom_load_u64(&pPool->bumpCount), "Trying to free an address the pool never handed out");
+#if MEM_ENABLE_ACCOUNTING
+    _account_free((uint32_t)poolIndex, pPool->pTags[_pool_block_index(pPool, p) - 1], pPool->elementSize);
+#endif
+    MEM_TRACE(MEM_TRACE_POOL_FREE, p, 0);
+    MemPoolMagazine* pMagazine = &gPoolMagazines[poolIndex];
+    if (pMagazine->count == POOL_MAGAZINE_CAPACITY) _pool_drain(pPool, pMagazine, POOL_MAGAZINE_BATCH);
 #if defined(_DEBUG)
-            memset(p, 0xDD, pPool->elementSize);
+    memset(p, 0xDD, pPool->elementSize);
 #endif
-            return;
+    pMagazine->pBlocks[pMagazine->count++] = p;
+}
+
+void mem_pool_release_thread_cache(void) {
+    for (uint32_t index = 0; index < POOL_COUNT; ++index) {
+        MemPoolMagazine* pMagazine = &gPoolMagazines[index];
+        if (pMagazine->count > 0) _pool_drain(&gMemPoolContext.pools[index], pMagazine, pMagazine->count);
+    }
+}
+
+void mem_pool_trim(void) {
+    for (uint32_t index = 0; index < POOL_COUNT; ++index) {
+        MemPool* pPool = &gMemPoolContext.pools[index];
+        uint32_t bumpCount = (uint32_t)UT_MIN(pPool->bumpCount, (uint64_t)pPool->capacity);
+        if (bumpCount == 0) continue;
+
+        /* Mark free blocks in a bitmap, then the highest unmarked block is the new end of the pool. */
+        PageAllocation bitmapAlloc;
+        if (!mem_page_alloc(((size_t)bumpCount + 31) / 32 * sizeof(uint32_t), &bitmapAlloc)) continue;
+        uint32_t* pFreeBits = (uint32_t*)bitmapAlloc.pAddress;
+        for (uint32_t batch = (uint32_t)pPool->freeBatches; batch != 0; batch = _pool_link(pPool, batch)->nextBatch) {
+            for (uint32_t block = batch; block != 0; block = _pool_link(pPool, block)->next) {
+                pFreeBits[(block - 1) / 32] |= 1u << ((block - 1) % 32);
+            }
+        }
+        uint32_t newBumpCount = bumpCount;
+        while (newBumpCount > 0 && (pFreeBits[(newBumpCount - 1) / 32] & (1u << ((newBumpCount - 1) % 32)))) {
+            --newBumpCount;
+        }
+        mem_page_free(&bitmapAlloc);
+        if (newBumpCount == bumpCount) continue;
+
+        /* Relink the surviving free blocks in their old order, in batches a magazine can take. */
+        uint32_t firstBatch = 0;
+        uint32_t lastBatch = 0;
+        uint32_t last = 0;
+        uint32_t batchCount = 0;
+        uint32_t batch = (uint32_t)pPool->freeBatches;
+        while (batch != 0) {
+            uint32_t nextBatch = _pool_link(pPool, batch)->nextBatch;
+            uint32_t block = batch;
+            while (block != 0) {
+                uint32_t next = _pool_link(pPool, block)->next;
+                if (block <= newBumpCount) {
+                    if (batchCount == 0) {
+                        if (lastBatch != 0) _pool_link(pPool, lastBatch)->nextBatch = block;
+                        else firstBatch = block;
+                        lastBatch = block;
+                    } else {
+                        _pool_link(pPool, last)->next = block;
+                    }
+                    _pool_link(pPool, block)->next = 0;
+                    _pool_link(pPool, block)->nextBatch = 0;
+                    last = block;
+                    batchCount = (batchCount + 1) % POOL_MAGAZINE_BATCH;
+                }
+                block = next;
+            }
+            batch = nextBatch;
+        }
+        pPool->freeBatches = _pool_stack_head(pPool->freeBatches, firstBatch);
+        pPool->bumpCount = newBumpCount;
+
+        uint64_t keepByteSize = ((uint64_t)newBumpCount << pPool->elementShift);
+        keepByteSize = (keepByteSize + POOL_COMMIT_GRANULE - 1) & ~(uint64_t)(POOL_COMMIT_GRANULE - 1);
+        if (keepByteSize < pPool->committedByteSize) {
+            size_t offset = UT_POINTER_TO_UINT(pPool->pHead) - UT_POINTER_TO_UINT(gMemPoolContext.pageAlloc.pAddress);
+            if (mem_page_decommit(&gMemPoolContext.pageAlloc, offset + (size_t)keepByteSize, (size_t)(pPool->committedByteSize - keepByteSize))) {
+                pPool->committedByteSize = keepByteSize;
+            }
         }
     }
-    DBG_ASSERT(0, "Trying de free memory that doesn't belong to any pool on the current context");
+}
+
+size_t mem_pool_committed_size(void) {
+    size_t size = 0;
+    for (uint32_t index = 0; index < POOL_COUNT; ++index) {
+        size += (size_t)atom_load_u64(&gMemPoolContext.pools[index].committedByteSize);
+    }
+    return size;
 }
 
 size_t mem_pool_used_size(void) {
     size_t size = 0;
     for (uint32_t index = 0; index < POOL_COUNT; ++index) {
-        size += gMemPoolContext.pools[index].usedByteSize;
+        size += (size_t)atom_load_u64(&gMemPoolContext.pools[index].usedByteSize);
+    }
+    return size;
+}
+
+static size_t _heap_block_size(const MemHeapBlock* pBlock) {
+    return pBlock->size & ~HEAP_BLOCK_FREE;
+}
+
+static MemHeapBlock* _heap_next_block(const MemHeapBlock* pBlock) {
+    return (MemHeapBlock*)UT_FORWARD_POINTER(pBlock, HEAP_BLOCK_HEADER_SIZE + _heap_block_size(pBlock));
+}
+
+static void _heap_mapping(size_t size, uint32_t* pFl, uint32_t* pSl) {
+    if (size < HEAP_SMALL_BLOCK_SIZE) {
+        *pFl = 0;
+        *pSl = (uint32_t)(size >> HEAP_ALIGN_LOG2);
+    } else {
+        uint32_t fl = UT_BIT_SCAN_REVERSE(size);
+        *pSl = (uint32_t)(size >> (fl - HEAP_SL_LOG2)) ^ HEAP_SL_COUNT;
+        *pFl = fl - (HEAP_FL_SHIFT - 1);
+    }
+}
+
+static void _heap_insert(MemHeapContext* pHeap, MemHeapBlock* pBlock) {
+    uint32_t fl, sl;
+    _heap_mapping(_heap_block_size(pBlock), &fl, &sl);
+    MemHeapBlock* pHead = pHeap->pFreeLists[fl][sl];
+    pBlock->size |= HEAP_BLOCK_FREE;
+    pBlock->pPrevFree = NULL;
+    pBlock->pNextFree = pHead;
+    if (pHead != NULL) pHead->pPrevFree = pBlock;
+    pHeap->pFreeLists[fl][sl] = pBlock;
+    pHeap->slBitmaps[fl] |= 1u << sl;
+    pHeap->flBitmap |= 1u << fl;
+}
+
+static void _heap_remove(MemHeapContext* pHeap, MemHeapBlock* pBlock) {
+    uint32_t fl, sl;
+    _heap_mapping(_heap_block_size(pBlock), &fl, &sl);
+    if (pBlock->pPrevFree != NULL) pBlock->pPrevFree->pNextFree = pBlock->pNextFree;
+    else pHeap->pFreeLists[fl][sl] = pBlock->pNextFree;
+    if (pBlock->pNextFree != NULL) pBlock->pNextFree->pPrevFree = pBlock->pPrevFree;
+    if (pHeap->pFreeLists[fl][sl] == NULL) {
+        pHeap->slBitmaps[fl] &= ~(1u << sl);
+        if (pHeap->slBitmaps[fl] == 0) pHeap->flBitmap &= ~(1u << fl);
     }
+    pBlock->size &= ~HEAP_BLOCK_FREE;
+}
+
+/* Rounds the size up to the next bin boundary so any block in the bin found is big enough. */
+static size_t _heap_search_size(size_t size) {
+    if (size >= HEAP_SMALL_BLOCK_SIZE) size += ((size_t)1 << (UT_BIT_SCAN_REVERSE(size) - HEAP_SL_LOG2)) - 1;
     return size;
 }
+
+static MemHeapBlock* _heap_find(MemHeapContext* pHeap, size_t size) {
+    size = _heap_search_size(size);
+    if (size >= HEAP_REGION_SIZE) return NULL;
+    uint32_t fl, sl;
+    _heap_mapping(size, &fl, &sl);
+    uint32_t slMap = pHeap->slBitmaps[fl] & (~0u << sl);
+    if (slMap == 0) {
+        uint32_t flMap = (fl + 1 < 32) ? pHeap->flBitmap & (~0u << (fl + 1)) : 0;
+        if (flMap == 0) return NULL;
+        fl = UT_BIT_SCAN_FORWARD(flMap);
+        slMap = pHeap->slBitmaps[fl];
+    }
+    return pHeap->pFreeLists[fl][UT_BIT_SCAN_FORWARD(slMap)];
+}
+
+static void _heap_merge_insert(MemHeapContext* pHeap, MemHeapBlock* pBlock) {
+    MemHeapBlock* pNext = _heap_next_block(pBlock);
+    if (pNext->size & HEAP_BLOCK_FREE) {
+        _heap_remove(pHeap, pNext);
+        pBlock->size += HEAP_BLOCK_HEADER_SIZE + pNext->size;
+        _heap_next_block(pBlock)->pPrevPhysical = pBlock;
+    }
+    MemHeapBlock* pPrev = pBlock->pPrevPhysical;
+    if (pPrev != NULL && (pPrev->size & HEAP_BLOCK_FREE)) {
+        _heap_remove(pHeap, pPrev);
+        pPrev->size += HEAP_BLOCK_HEADER_SIZE + pBlock->size;
+        _heap_next_block(pPrev)->pPrevPhysical = pPrev;
+        pBlock = pPrev;
+    }
+    _heap_insert(pHeap, pBlock);
+}
+
+/* Splits the tail past size off into a free block when it can hold one. */
+static void _heap_split(MemHeapContext* pHeap, MemHeapBlock* pBlock, size_t size) {
+    size_t blockSize = _heap_block_size(pBlock);
+    if (blockSize < size + sizeof(MemHeapBlock)) return;
+    MemHeapBlock* pRemainder = (MemHeapBlock*)UT_FORWARD_POINTER(pBlock, HEAP_BLOCK_HEADER_SIZE + size);
+    pRemainder->pPrevPhysical = pBlock;
+    pRemainder->size = blockSize - size - HEAP_BLOCK_HEADER_SIZE;
+    pBlock->size = size;
+    _heap_next_block(pRemainder)->pPrevPhysical = pRemainder;
+    _heap_insert(pHeap, pRemainder);
+}
+
+/*
+ Turns the sentinel into a free block over newly committed pages and closes the range again behind it.
+ Grows by the rounded search size, a block only as big as the request could sit in a bin below it.
+*/
+static bool32_t _heap_grow(MemHeapContext* pHeap, size_t size) {
+    size = _heap_search_size(size);
+    size_t growSize = (size + 2 * HEAP_BLOCK_HEADER_SIZE + HEAP_COMMIT_GRANULE - 1) & ~(HEAP_COMMIT_GRANULE - 1);
+    if (growSize > HEAP_REGION_SIZE - pHeap->committedByteSize) return UT_FALSE;
+    if (!mem_page_commit(&pHeap->pageAlloc, pHeap->committedByteSize, growSize)) return UT_FALSE;
+#if (MEM_HEAP_PAGE_FLAGS) & MEM_PAGE_PREFAULT
+    memset(UT_FORWARD_POINTER(pHeap->pageAlloc.pAddress, pHeap->committedByteSize), 0, growSize);
+#endif
+    MemHeapBlock* pBlock = pHeap->pSentinel;
+    pBlock->size = growSize - HEAP_BLOCK_HEADER_SIZE;
+    pHeap->pSentinel = _heap_next_block(pBlock);
+    pHeap->pSentinel->pPrevPhysical = pBlock;
+    pHeap->pSentinel->size = 0;
+    pHeap->committedByteSize += growSize;
+    _heap_merge_insert(pHeap, pBlock);
+    return UT_TRUE;
+}
+
+void* mem_heap_alloc(size_t size, uint32_t alignment) {
+    DBG_ASSERT(UT_IS_POT(alignment), "Heap alignment %u is not a power of two", alignment);
+    size_t requestedSize = size;
+    UT_UNUSED(requestedSize);
+    size = (UT_MAX(size, HEAP_ALIGNMENT) + HEAP_ALIGNMENT - 1) & ~(HEAP_ALIGNMENT - 1);
+    /* Over-aligned blocks search for enough slack to split a free block off their front. */
+    size_t searchSize = (alignment > HEAP_ALIGNMENT) ? size + alignment + sizeof(MemHeapBlock) : size;
+    if (searchSize >= HEAP_REGION_SIZE) return NULL;
+    MemHeapContext* pHeap = &gMemHeapContext;
+    atom_spin_lock(&pHeap->lock);
+    MemHeapBlock* pBlock = _heap_find(pHeap, searchSize);
+    if (pBlock == NULL && _heap_grow(pHeap, searchSize)) pBlock = _heap_find(pHeap, searchSize);
+    if (pBlock == NULL) {
+        atom_spin_unlock(&pHeap->lock);
+        return NULL;
+    }
+    _heap_remove(pHeap, pBlock);
+    void* pPayload = UT_FORWARD_POINTER(pBlock, HEAP_BLOCK_HEADER_SIZE);
+    if (!UT_IS_POINTER_ALIGNED(pPayload, alignment)) {
+        void* pAligned = UT_ALIGN_POINTER(pPayload, alignment);
+        if (UT_POINTER_TO_UINT(pAligned) - UT_POINTER_TO_UINT(pPayload) < sizeof(MemHeapBlock)) {
+            pAligned = UT_ALIGN_POINTER(UT_FORWARD_POINTER(pPayload, sizeof(MemHeapBlock)), alignment);
+        }
+        size_t gap = UT_POINTER_TO_UINT(pAligned) - UT_POINTER_TO_UINT(pPayload);
+        MemHeapBlock* pAlignedBlock = (MemHeapBlock*)UT_FORWARD_POINTER(pBlock, gap);
+        pAlignedBlock->pPrevPhysical = pBlock;
+        pAlignedBlock->size = pBlock->size - gap;
+        _heap_next_block(pAlignedBlock)->pPrevPhysical = pAlignedBlock;
+        pBlock->size = gap - HEAP_BLOCK_HEADER_SIZE;
+        _heap_insert(pHeap, pBlock);
+        pBlock = pAlignedBlock;
+        pPayload = pAligned;
+    }
+    _heap_split(pHeap, pBlock, size);
+    pHeap->usedByteSize += pBlock->size;
+    atom_spin_unlock(&pHeap->lock);
+#if MEM_ENABLE_ACCOUNTING
+    pBlock->tag = _current_tag();
+    _account_alloc(POOL_COUNT, (uint8_t)pBlock->tag, pBlock->size);
+#endif
+    MEM_TRACE(MEM_TRACE_HEAP_ALLOC, pPayload, requestedSize);
+#if defined(_DEBUG)
+    memset(pPayload, 0xAA, pBlock->size);
+#endif
+    return pPayload;
+}
+
+void mem_heap_free(void* p) {
+    if (p == NULL) return;
+    MemHeapContext* pHeap = &gMemHeapContext;
+    DBG_ASSERT(UT_POINTER_TO_UINT(p) - UT_POINTER_TO_UINT(pHeap->pageAlloc.pAddress) < pHeap->committedByteSize, "Trying to free memory that doesn't belong to the heap");
+    MemHeapBlock* pBlock = (MemHeapBlock*)UT_FORWARD_POINTER(p, -(intptr_t)HEAP_BLOCK_HEADER_SIZE);
+    DBG_ASSERT(!(pBlock->size & HEAP_BLOCK_FREE), "Trying to free a heap block twice");
+#if MEM_ENABLE_ACCOUNTING
+    _account_free(POOL_COUNT, (uint8_t)pBlock->tag, pBlock->size);
+#endif
+    MEM_TRACE(MEM_TRACE_HEAP_FREE, p, 0);
+#if defined(_DEBUG)
+    memset(p, 0xDD, pBlock->size);
+#endif
+    atom_spin_lock(&pHeap->lock);
+    pHeap->usedByteSize -= pBlock->size;
+    _heap_merge_insert(pHeap, pBlock);
+    atom_spin_unlock(&pHeap->lock);
+}
+
+size_t mem_heap_used_size(void) {
+    return gMemHeapContext.usedByteSize;
+}
+
+size_t mem_heap_committed_size(void) {
+    return gMemHeapContext.committedByteSize;
+}
+
+void* mem_alloc(size_t size) {
+    if (size <= POOL_SIZE(POOL_COUNT - 1)) return mem_pool_alloc(size);
+    return mem_heap_alloc(size, (uint32_t)HEAP_ALIGNMENT);
+}
+
+void mem_free(void* p) {
+    if (p == NULL) return;
+    if (UT_POINTER_TO_UINT(p) - UT_POINTER_TO_UINT(gMemPoolContext.pageAlloc.pAddress) < gMemPoolContext.pageAlloc.size) {
+        mem_pool_free(p);
+    } else {
+        mem_heap_free(p);
+    }
+}
+
+void mem_push_tag(MemTag tag) {
+#if MEM_TRACK_TAGS
+    DBG_ASSERT(gMemTagStackCount < MEM_TAG_STACK_CAPACITY, "Memory tags nested deeper than %u", MEM_TAG_STACK_CAPACITY);
+    gMemTagStack[gMemTagStackCount++] = (uint8_t)tag;
+#else
+    UT_UNUSED(tag);
+#endif
+}
+
+void mem_pop_tag(void) {
+#if MEM_TRACK_TAGS
+    DBG_ASSERT(gMemTagStackCount > 0, "Popping a memory tag that was never pushed");
+    --gMemTagStackCount;
+#endif
+}
+
+MemStats mem_get_tag_stats(MemTag tag) {
+    MemStats stats = { 0 };
+#if MEM_ENABLE_ACCOUNTING
+    if ((uint32_t)tag < MEM_TAG_COUNT) stats = gMemTagStats[tag];
+#else
+    UT_UNUSED(tag);
+#endif
+    return stats;
+}
+
+MemStats mem_get_size_class_stats(uint32_t sizeClass) {
+    MemStats stats = { 0 };
+#if MEM_ENABLE_ACCOUNTING
+    if (sizeClass < MEM_SIZE_CLASS_COUNT) stats = gMemSizeClassStats[sizeClass];
+#else
+    UT_UNUSED(sizeClass);
+#endif
+    return stats;
+}
+
+#if MEM_ENABLE_ACCOUNTING
+static void _dump_stats(FILE* pFile, const char* pName, const MemStats* pStats) {
+    if (pStats->totalCount == 0) return;
+    fprintf(pFile, "  %-9s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 " %8" PRIu64 " %10" PRIu64 "\n",
+            pName, pStats->currentByteSize, pStats->peakByteSize, pStats->framePeakByteSize, pStats->currentCount, pStats->totalCount);
+}
+#endif
+
+void mem_dump_report(FILE* pFile) {
+#if MEM_ENABLE_ACCOUNTING
+    char name[16];
+    fprintf(pFile, "mem frame %" PRIu64 ": linear %zu/%zu pool committed %zu heap committed %zu\n",
+            gMemFrameIndex, mem_linear_used_size(), mem_linear_peak_size(), mem_pool_committed_size(), mem_heap_committed_size());
+    fprintf(pFile, "  %-9s %10s %10s %10s %8s %10s\n", "tag", "bytes", "peak", "frame peak", "live", "allocs");
+    for (uint32_t index = 0; index < MEM_TAG_COUNT; ++index) {
+        _dump_stats(pFile, kMemTagNames[index], &gMemTagStats[index]);
+    }
+    fprintf(pFile, "  class\n");
+    for (uint32_t index = 0; index < MEM_SIZE_CLASS_COUNT; ++index) {
+        if (index < POOL_COUNT) snprintf(name, sizeof(name), "%zu", POOL_SIZE(index));
+        else snprintf(name, sizeof(name), "heap");
+        _dump_stats(pFile, name, &gMemSizeClassStats[index]);
+    }
+#else
+    fprintf(pFile, "mem: accounting is compiled out (MEM_ENABLE_ACCOUNTING)\n");
+#endif
+}
+
+bool32_t mem_trace_begin(const char* pPath) {
+#if MEM_ENABLE_TRACE
+    mem_trace_end();
+    FILE* pFile = fopen(pPath, "wb");
+    if (pFile == NULL) return UT_FALSE;
+    MemTraceHeader header = { MEM_TRACE_MAGIC, MEM_TRACE_VERSION, MEM_POOL_MIN_SIZE_SHIFT, MEM_POOL_MAX_SIZE_SHIFT };
+    fwrite(&header, sizeof(header), 1, pFile);
+    atom_spin_lock(&gMemTrace.lock);
+    gMemTrace.pFile = pFile;
+    gMemTrace.count = 0;
+    atom_spin_unlock(&gMemTrace.lock);
+    atom_store_u32(&gMemTrace.enabled, 1);
+    return UT_TRUE;
+#else
+    UT_UNUSED(pPath);
+    return UT_FALSE;
+#endif
+}
+
+void mem_trace_end(void) {
+#if MEM_ENABLE_TRACE
+    atom_store_u32(&gMemTrace.enabled, 0);
+    atom_spin_lock(&gMemTrace.lock);
+    if (gMemTrace.pFile != NULL) {
+        _trace_flush();
+        fclose(gMemTrace.pFile);
+        gMemTrace.pFile = NULL;
+    }
+    atom_spin_unlock(&gMemTrace.lock);
+#endif
+}
@@ -2,6 +2,7 @@
 #define _MEMORY_H_
 
 #include "types.h"
+#include <stdio.h>
 
 #if (defined(UINTPTR_MAX) && UINTPTR_MAX == UINT32_MAX)
 #define MEM_DEFAULT_ALIGNMENT 4
@@ -11,30 +12,145 @@
 #error "Invalid Platform Architecture"
 #endif
 
+/*
+ Page allocation flags. Huge pages are a hint, backends fall back to regular pages
+ when the platform has none available, so callers never have to handle the difference.
+ MEM_PAGE_HUGE asks for transparent huge pages, MEM_PAGE_HUGE_EXPLICIT for pages from
+ the reserved huge page pool (hugetlbfs on Linux), rounding the size up to a huge page.
+ MEM_PAGE_PREFAULT faults every page in at allocation time instead of on first touch.
+*/
+#define MEM_PAGE_DEFAULT 0
+#define MEM_PAGE_HUGE (1 << 0)
+#define MEM_PAGE_HUGE_EXPLICIT (1 << 1)
+#define MEM_PAGE_PREFAULT (1 << 2)
+
 typedef struct {
     void* pAddress;
     size_t size;
 } PageAllocation;
 
+typedef enum {
+    MEM_TAG_UNTAGGED,
+    MEM_TAG_GFX,
+    MEM_TAG_TEXTURES,
+    MEM_TAG_ASSETS,
+    MEM_TAG_GAME,
+    MEM_TAG_COUNT
+} MemTag;
+
+typedef struct {
+    uint64_t currentByteSize;
+    uint64_t peakByteSize;
+    uint64_t framePeakByteSize;  /* peak since the last mem_frame_begin */
+    uint64_t currentCount;
+    uint64_t totalCount;
+} MemStats;
+
+#define MEM_LINEAR_MAX_SCOPES 16
+
+typedef struct {
+    void* pCurr;
+    size_t usedByteSize;
+} MemLinearMarker;
+
 typedef struct _LinearContext {
     PageAllocation pageAlloc;
     void* pHead;
     void* pCurr;
     size_t usedByteSize;
+    size_t peakByteSize;
+    MemLinearMarker scopes[MEM_LINEAR_MAX_SCOPES];
+    uint32_t scopeCount;
 } MemLinearContext;
 
-void mem_initialize(void);
+/* Returns UT_FALSE, with nothing left mapped, when the platform can't reserve the regions. */
+bool32_t mem_initialize(void);
 void mem_shutdown(void);
 bool32_t mem_page_alloc(size_t size, PageAllocation* pAllocationInfo);
+bool32_t mem_page_alloc_flags(size_t size, uint32_t flags, PageAllocation* pAllocationInfo);
 bool32_t mem_page_free(const PageAllocation* pAllocationInfo);
+/*
+ Reserves address space without backing it. Pages must be committed before they are
+ touched and decommitted pages give their physical memory back but keep the range.
+ Commit rounds its range out to whole pages, decommit rounds it in so neighbouring data survives.
+ MEM_PAGE_PREFAULT has no effect on reservations.
+ A reservation is released with mem_page_free.
+*/
+bool32_t mem_page_reserve(size_t size, uint32_t flags, PageAllocation* pAllocationInfo);
+bool32_t mem_page_commit(const PageAllocation* pAllocationInfo, size_t offset, size_t size);
+bool32_t mem_page_decommit(const PageAllocation* pAllocationInfo, size_t offset, size_t size);
 void mem_linear_set_context(MemLinearContext* pContext);
 void* mem_linear_alloc(size_t size, uint32_t alignment);
 void mem_linear_reset(void);
 void mem_linear_set_default_context(void);
+/*
+ Markers release everything allocated after them on the current linear context, so
+ temporary work can hand its scratch back before the frame ends. Scopes keep a stack of
+ markers, every push must be matched by a pop before the context is reset.
+*/
+MemLinearMarker mem_linear_get_marker(void);
+void mem_linear_free_to_marker(MemLinearMarker marker);
+void mem_linear_push_scope(void);
+void mem_linear_pop_scope(void);
+/*
+ Pool calls are safe from any thread, blocks may be freed on a different thread than
+ the one that allocated them. Every thread caches some free blocks per size class, so
+ threads must call mem_pool_release_thread_cache before they exit to hand their cache
+ back. mem_pool_used_size counts cached blocks as used.
+*/
 void* mem_pool_alloc(size_t size);
 void mem_pool_free(void* p);
+void mem_pool_release_thread_cache(void);
+/*
+ Pools commit pages as they grow. mem_pool_trim hands back the pages past the last block
+ still in use and must not overlap any other pool call. Blocks sitting in a thread cache
+ count as in use, so release the caches first to trim as much as possible.
+*/
+void mem_pool_trim(void);
+size_t mem_pool_committed_size(void);
 size_t mem_pool_used_size(void);
+/*
+ The heap serves any size and any power of two alignment in O(1) time. It is
+ meant for blocks past the largest pool class and is safe from any thread.
+ mem_alloc picks a pool or the heap by size, and mem_free takes memory from either.
+*/
+void* mem_heap_alloc(size_t size, uint32_t alignment);
+void mem_heap_free(void* p);
+size_t mem_heap_committed_size(void);
+size_t mem_heap_used_size(void);
+void* mem_alloc(size_t size);
+void mem_free(void* p);
 size_t mem_linear_used_size(void);
+size_t mem_linear_peak_size(void);
+/*
+ Pool and heap allocations are charged to the calling thread's current tag, which is
+ pushed around a subsystem's allocations. Counters exist when MEM_ENABLE_ACCOUNTING is
+ set (see config_mem.h), otherwise the stats are zero and the report says so.
+ Size class stats are indexed by pool class, with the heap after the last pool.
+*/
+void mem_push_tag(MemTag tag);
+void mem_pop_tag(void);
+MemStats mem_get_tag_stats(MemTag tag);
+MemStats mem_get_size_class_stats(uint32_t sizeClass);
+void mem_dump_report(FILE* pFile);
+/*
+ Records every pool, heap and linear call to a binary trace (see memory_trace.h) until
+ mem_trace_end. Needs MEM_ENABLE_TRACE, otherwise mem_trace_begin returns false.
+*/
+bool32_t mem_trace_begin(const char* pPath);
+void mem_trace_end(void);
+/*
+ Frame arenas are linear contexts handed out round robin, one per frame. Memory from
+ mem_frame_alloc lives until the consumer of that frame (a GPU completion handler, a
+ render thread or the headless runner) calls mem_frame_retire, which may happen on any
+ thread. mem_frame_begin waits for the arena it reuses to be retired and then resets it,
+ so data the consumer reads can be written there once instead of being copied.
+ mem_frame_context can be set as the current linear context to use markers and scopes.
+*/
+uint64_t mem_frame_begin(void);
+void mem_frame_retire(uint64_t frameIndex);
+void* mem_frame_alloc(size_t size, uint32_t alignment);
+MemLinearContext* mem_frame_context(void);
 size_t mem_system_page_size(void);
 
 #endif
@@ -1,6 +1,16 @@
 #include "memory.h"
 #include "utils.h"
 #include <mach/mach.h>
+#include <sys/mman.h>
+
+#define MEM_HUGE_PAGE_SIZE UT_MB(2)
+
+static void _prefault(void* pAddress, size_t size) {
+    size_t pageSize = mem_system_page_size();
+    for (size_t offset = 0; offset < size; offset += pageSize) {
+        *(volatile byte_t*)UT_FORWARD_POINTER(pAddress, offset) = 0;
+    }
+}
 
 size_t mem_system_page_size(void) {
     vm_size_t size = 0;
@@ -9,11 +19,26 @@ size_t mem_system_page_size(void) {
 }
 
 bool32_t mem_page_alloc(size_t size, PageAllocation* pAllocationInfo) {
+    return mem_page_alloc_flags(size, MEM_PAGE_DEFAULT, pAllocationInfo);
+}
+
+bool32_t mem_page_alloc_flags(size_t size, uint32_t flags, PageAllocation* pAllocationInfo) {
     vm_address_t address = 0;
     vm_size_t pageSize = round_page(size);
-    kern_return_t result = KERN_SUCCESS;
-    result = vm_allocate(mach_task_self(), &address, pageSize, VM_FLAGS_ANYWHERE);
+    kern_return_t result = KERN_FAILURE;
+#if defined(VM_FLAGS_SUPERPAGE_SIZE_2MB)
+    /* Superpages only exist on Intel Macs, XNU has no transparent huge pages so both flags map here. */
+    if ((flags & (MEM_PAGE_HUGE | MEM_PAGE_HUGE_EXPLICIT)) && size >= MEM_HUGE_PAGE_SIZE) {
+        vm_size_t hugeSize = (size + MEM_HUGE_PAGE_SIZE - 1) & ~((vm_size_t)MEM_HUGE_PAGE_SIZE - 1);
+        result = vm_allocate(mach_task_self(), &address, hugeSize, VM_FLAGS_ANYWHERE | VM_FLAGS_SUPERPAGE_SIZE_2MB);
+        if (result == KERN_SUCCESS) pageSize = hugeSize;
+    }
+#endif
+    if (result != KERN_SUCCESS) {
+        result = vm_allocate(mach_task_self(), &address, pageSize, VM_FLAGS_ANYWHERE);
+    }
     if (result != KERN_SUCCESS) return UT_FALSE;
+    if (flags & MEM_PAGE_PREFAULT) _prefault((void*)address, pageSize);
     pAllocationInfo->pAddress = (void*)address;
     pAllocationInfo->size = pageSize;
     return UT_TRUE;
@@ -25,3 +50,43 @@ bool32_t mem_page_free(const PageAllocation* pAllocationInfo) {
     if (result != KERN_SUCCESS) return UT_FALSE;
     return UT_TRUE;
 }
+
+bool32_t mem_page_reserve(size_t size, uint32_t flags, PageAllocation* pAllocationInfo) {
+    /* XNU wires superpages when they are mapped, so they can't be reserved and committed later. Reservations always use regular pages here. */
+    UT_UNUSED(flags);
+    vm_address_t address = 0;
+    vm_size_t pageSize = round_page(size);
+    kern_return_t result = vm_allocate(mach_task_self(), &address, pageSize, VM_FLAGS_ANYWHERE);
+    if (result != KERN_SUCCESS) return UT_FALSE;
+    result = vm_protect(mach_task_self(), address, pageSize, FALSE, VM_PROT_NONE);
+    if (result != KERN_SUCCESS) {
+        vm_deallocate(mach_task_self(), address, pageSize);
+        return UT_FALSE;
+    }
+    pAllocationInfo->pAddress = (void*)address;
+    pAllocationInfo->size = pageSize;
+    return UT_TRUE;
+}
+
+bool32_t mem_page_commit(const PageAllocation* pAllocationInfo, size_t offset, size_t size) {
+    vm_address_t start = trunc_page(offset);
+    vm_address_t end = UT_MIN(round_page(offset + size), pAllocationInfo->size);
+    if (end <= start) return UT_TRUE;
+    void* pAddress = UT_FORWARD_POINTER(pAllocationInfo->pAddress, start);
+    kern_return_t result = vm_protect(mach_task_self(), (vm_address_t)pAddress, end - start, FALSE, VM_PROT_READ | VM_PROT_WRITE);
+    if (result != KERN_SUCCESS) return UT_FALSE;
+    /* Tells the pager the pages are in use again after a decommit, fails harmlessly otherwise. */
+    madvise(pAddress, end - start, MADV_FREE_REUSE);
+    return UT_TRUE;
+}
+
+bool32_t mem_page_decommit(const PageAllocation* pAllocationInfo, size_t offset, size_t size) {
+    vm_address_t start = round_page(offset);
+    vm_address_t end = UT_MIN(trunc_page(offset + size), pAllocationInfo->size);
+    if (end <= start) return UT_TRUE;
+    void* pAddress = UT_FORWARD_POINTER(pAllocationInfo->pAddress, start);
+    if (madvise(pAddress, end - start, MADV_FREE_REUSABLE) != 0) return UT_FALSE;
+    kern_return_t result = vm_protect(mach_task_self(), (vm_address_t)pAddress, end - start, FALSE, VM_PROT_NONE);
+    if (result != KERN_SUCCESS) return UT_FALSE;
+    return UT_TRUE;
+}
@@ -0,0 +1,129 @@
+#include "memory.h"
+#include "utils.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* Default huge page size on x86_64 and 4K granule arm64, MAP_HUGETLB uses the system default size. */
+#define MEM_HUGE_PAGE_SIZE UT_MB(2)
+
+static size_t gPageSize = 0;
+
+static size_t _round_up(size_t size, size_t alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/*
+ Transparent huge pages only back 2MB aligned ranges, so the mapping is over-reserved
+ by one huge page and the unaligned head and tail are trimmed off again.
+*/
+static void* _map_huge_aligned(size_t size, int32_t protection, int32_t mapFlags) {
+    size_t mappedSize = size + MEM_HUGE_PAGE_SIZE;
+    void* pMapped = mmap(NULL, mappedSize, protection, mapFlags, -1, 0);
+    if (pMapped == MAP_FAILED) return NULL;
+    void* pAligned = UT_ALIGN_POINTER(pMapped, MEM_HUGE_PAGE_SIZE);
+    size_t headSize = (size_t)((uintptr_t)pAligned - (uintptr_t)pMapped);
+    size_t tailSize = mappedSize - headSize - size;
+    if (headSize > 0) munmap(pMapped, headSize);
+    if (tailSize > 0) munmap(UT_FORWARD_POINTER(pAligned, size), tailSize);
+    madvise(pAligned, size, MADV_HUGEPAGE);
+    return pAligned;
+}
+
+static void _prefault(void* pAddress, size_t size) {
+#if defined(MADV_POPULATE_WRITE)
+    if (madvise(pAddress, size, MADV_POPULATE_WRITE) == 0) return;
+#endif
+    /* Kernels before 5.14, writing a byte per page faults it in (and keeps the huge page hint effective). */
+    size_t pageSize = mem_system_page_size();
+    for (size_t offset = 0; offset < size; offset += pageSize) {
+        *(volatile byte_t*)UT_FORWARD_POINTER(pAddress, offset) = 0;
+    }
+}
+
+size_t mem_system_page_size(void) {
+    if (gPageSize == 0) {
+        long size = sysconf(_SC_PAGESIZE);
+        gPageSize = size > 0 ? (size_t)size : UT_KB(4);
+    }
+    return gPageSize;
+}
+
+bool32_t mem_page_alloc(size_t size, PageAllocation* pAllocationInfo) {
+    return mem_page_alloc_flags(size, MEM_PAGE_DEFAULT, pAllocationInfo);
+}
+
+bool32_t mem_page_alloc_flags(size_t size, uint32_t flags, PageAllocation* pAllocationInfo) {
+    const int32_t protection = PROT_READ | PROT_WRITE;
+    const int32_t mapFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+    size_t pageSize = _round_up(size, mem_system_page_size());
+    void* pAddress = NULL;
+
+    if ((flags & MEM_PAGE_HUGE_EXPLICIT) && size >= MEM_HUGE_PAGE_SIZE) {
+        /* Fails when no huge pages are reserved (vm.nr_hugepages), then transparent huge pages are tried instead. */
+        size_t hugeSize = _round_up(size, MEM_HUGE_PAGE_SIZE);
+        int32_t hugeFlags = mapFlags | MAP_HUGETLB | ((flags & MEM_PAGE_PREFAULT) ? MAP_POPULATE : 0);
+        pAddress = mmap(NULL, hugeSize, protection, hugeFlags, -1, 0);
+        if (pAddress != MAP_FAILED) {
+            pAllocationInfo->pAddress = pAddress;
+            pAllocationInfo->size = hugeSize;
+            return UT_TRUE;
+        }
+        pAddress = NULL;
+    }
+
+    if ((flags & (MEM_PAGE_HUGE | MEM_PAGE_HUGE_EXPLICIT)) && size >= MEM_HUGE_PAGE_SIZE) {
+        /* MAP_POPULATE would fault in small pages before the hint is set, so prefaulting waits for madvise. */
+        pAddress = _map_huge_aligned(pageSize, protection, mapFlags);
+        if (pAddress == NULL) return UT_FALSE;
+        if (flags & MEM_PAGE_PREFAULT) _prefault(pAddress, pageSize);
+    } else {
+        pAddress = mmap(NULL, pageSize, protection, mapFlags | ((flags & MEM_PAGE_PREFAULT) ? MAP_POPULATE : 0), -1, 0);
+        if (pAddress == MAP_FAILED) return UT_FALSE;
+    }
+
+    pAllocationInfo->pAddress = pAddress;
+    pAllocationInfo->size = pageSize;
+    return UT_TRUE;
+}
+
+bool32_t mem_page_free(const PageAllocation* pAllocationInfo) {
+    if (munmap(pAllocationInfo->pAddress, pAllocationInfo->size) != 0) return UT_FALSE;
+    return UT_TRUE;
+}
+
+bool32_t mem_page_reserve(size_t size, uint32_t flags, PageAllocation* pAllocationInfo) {
+    /* hugetlbfs pages can't be committed piecemeal, so explicit huge pages fall back to transparent ones here. */
+    const int32_t mapFlags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+    size_t pageSize = _round_up(size, mem_system_page_size());
+    void* pAddress = NULL;
+    if ((flags & (MEM_PAGE_HUGE | MEM_PAGE_HUGE_EXPLICIT)) && size >= MEM_HUGE_PAGE_SIZE) {
+        pAddress = _map_huge_aligned(pageSize, PROT_NONE, mapFlags);
+        if (pAddress == NULL) return UT_FALSE;
+    } else {
+        pAddress = mmap(NULL, pageSize, PROT_NONE, mapFlags, -1, 0);
+        if (pAddress == MAP_FAILED) return UT_FALSE;
+    }
+    pAllocationInfo->pAddress = pAddress;
+    pAllocationInfo->size = pageSize;
+    return UT_TRUE;
+}
+
+bool32_t mem_page_commit(const PageAllocation* pAllocationInfo, size_t offset, size_t size) {
+    size_t pageSize = mem_system_page_size();
+    size_t start = offset & ~(pageSize - 1);
+    size_t end = UT_MIN(_round_up(offset + size, pageSize), pAllocationInfo->size);
+    if (end <= start) return UT_TRUE;
+    if (mprotect(UT_FORWARD_POINTER(pAllocationInfo->pAddress, start), end - start, PROT_READ | PROT_WRITE) != 0) return UT_FALSE;
+    return UT_TRUE;
+}
+
+bool32_t mem_page_decommit(const PageAllocation* pAllocationInfo, size_t offset, size_t size) {
+    size_t pageSize = mem_system_page_size();
+    size_t start = _round_up(offset, pageSize);
+    size_t end = UT_MIN((offset + size) & ~(pageSize - 1), pAllocationInfo->size);
+    if (end <= start) return UT_TRUE;
+    void* pAddress = UT_FORWARD_POINTER(pAllocationInfo->pAddress, start);
+    if (madvise(pAddress, end - start, MADV_DONTNEED) != 0) return UT_FALSE;
+    if (mprotect(pAddress, end - start, PROT_NONE) != 0) return UT_FALSE;
+    return UT_TRUE;
+}
@@ -0,0 +1,42 @@
+#ifndef _MEMORY_TRACE_H_
+#define _MEMORY_TRACE_H_
+
+#include "types.h"
+
+/*
+ Binary allocation trace written by mem_trace_begin/mem_trace_end and read by the
+ replay tool (src/linux/mem_replay.c). The file is a MemTraceHeader followed by
+ MemTraceRecords in the order the calls happened, in the writer's byte order.
+ Pool and heap records carry the requested size and the returned address, frees only
+ the address. Linear records use the context as the address and resets carry the
+ bytes still in use afterwards, so marker rollbacks are traced as well.
+*/
+#define MEM_TRACE_MAGIC 0x43525447u /* "GTRC" */
+#define MEM_TRACE_VERSION 1
+
+typedef enum {
+    MEM_TRACE_POOL_ALLOC,
+    MEM_TRACE_POOL_FREE,
+    MEM_TRACE_HEAP_ALLOC,
+    MEM_TRACE_HEAP_FREE,
+    MEM_TRACE_LINEAR_ALLOC,
+    MEM_TRACE_LINEAR_RESET
+} MemTraceOp;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t poolMinSizeShift;
+    uint32_t poolMaxSizeShift;
+} MemTraceHeader;
+
+typedef struct {
+    uint64_t address;
+    uint32_t frame;
+    uint32_t size;
+    uint8_t op;
+    uint8_t tag;
+    uint8_t padding[6];
+} MemTraceRecord;
+
+#endif
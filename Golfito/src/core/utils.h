@@ -12,6 +12,8 @@
 #define UT_IS_FALSE(value, bit) !UT_IS_TRUE(value, bit)
 #define UT_TOGGLE_BIT(value, bit) value = ((value) ^ (1 << (bit)))
 #define UT_CLAMP(a, b, c) ((a) < (b) ? (b) : ((a) > (c) ? (c) : (a)))
+#define UT_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define UT_MAX(a, b) ((a) > (b) ? (a) : (b))
 #define UT_TO_POINTER(value) ((void*)(value))
 #define UT_FORWARD_POINTER(pointer, offset) ((void*)((uintptr_t)UT_TO_POINTER(pointer) + offset))
 #define UT_POINTER_TO_UINT(pointer) ((uintptr_t)(pointer))
@@ -35,4 +37,24 @@
 (x)++;\
 }
 
+/* Index of the highest (reverse) or lowest (forward) set bit of a 32 bit value, x must not be 0. */
+#if defined(_MSC_VER)
+#include <intrin.h>
+static __inline uint32_t _ut_bit_scan_reverse(uint32_t x) {
+    unsigned long index;
+    _BitScanReverse(&index, x);
+    return (uint32_t)index;
+}
+static __inline uint32_t _ut_bit_scan_forward(uint32_t x) {
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return (uint32_t)index;
+}
+#define UT_BIT_SCAN_REVERSE(x) _ut_bit_scan_reverse((uint32_t)(x))
+#define UT_BIT_SCAN_FORWARD(x) _ut_bit_scan_forward((uint32_t)(x))
+#else
+#define UT_BIT_SCAN_REVERSE(x) ((uint32_t)(31 - __builtin_clz((uint32_t)(x))))
+#define UT_BIT_SCAN_FORWARD(x) ((uint32_t)__builtin_ctz((uint32_t)(x)))
+#endif
+
 #endif
@@ -1,5 +1,6 @@
 #include "boot.h"
 #include "../core/gfx.h"
+#include "../core/gfx_atlas.h"
 #include "../core/input.h"
 #include "../core/memory.h"
 #include <stdio.h>
@@ -8,6 +9,17 @@
 #include <time.h>
 
 #define MAX_SPRITES 8000
+#if defined(_WIN32)
+#define ASSET_PATH(name) "../assets/" name
+#else
+#define ASSET_PATH(name) name
+#endif
+/* App bundles are read-only, so only desktop builds with a plain assets folder cache the atlas layout. */
+#if defined(_WIN32) || defined(TARGET_LINUX)
+#define ATLAS_CACHE_PATH ASSET_PATH("atlas.cache")
+#else
+#define ATLAS_CACHE_PATH NULL
+#endif
 typedef struct {
     vec2_t position;
     vec2_t scaleRotation;
@@ -20,9 +32,11 @@ typedef struct {
     float32_t w, h;
 } Frame;
 static Frame frames[3] = { { 0, 0, 61, 99}, { 61, 0, 120, 120 }, { 181, 0, 114, 159 } };
-static TextureID sampleTexture = INVALID_TEXTURE_ID;
-static TextureID otherTexture = INVALID_TEXTURE_ID;
+static GfxAtlas atlas;
+static GfxAtlasRegion sampleRegion;
+static GfxAtlasRegion otherRegion;
 static Sprite sprites[MAX_SPRITES] = { 0.0f };
+static SpriteInstance instances[MAX_SPRITES];
 static uint32_t count = 1;
 static uint32_t currentFrame = 0;
 static vec2_t textureSize = { 0.0f, 0.0f };
@@ -40,18 +54,17 @@ void game_sys_shutdown(void) {
 }
 
 void game_start (void) {
-#if defined(_WIN32)
-    sampleTexture = gfx_load_texture("../assets/sheet.png");
-    assert(sampleTexture != INVALID_TEXTURE_ID);
-    otherTexture = gfx_load_texture("../assets/image.png");
-    assert(sampleTexture != INVALID_TEXTURE_ID);
-#else
-	sampleTexture = gfx_load_texture("sheet.png");
-	assert(sampleTexture != INVALID_TEXTURE_ID);
-    otherTexture = gfx_load_texture("image.png");
-    assert(otherTexture != INVALID_TEXTURE_ID);
-#endif
-    textureSize = gfx_get_texture_size(sampleTexture);
+    gfx_atlas_initialize(&atlas);
+    uint32_t sampleImage = gfx_atlas_add_image(&atlas, ASSET_PATH("sheet.png"));
+    assert(sampleImage != GFX_ATLAS_INVALID_IMAGE);
+    uint32_t otherImage = gfx_atlas_add_image(&atlas, ASSET_PATH("image.png"));
+    assert(otherImage != GFX_ATLAS_INVALID_IMAGE);
+    bool32_t isBuilt = gfx_atlas_build(&atlas, ATLAS_CACHE_PATH);
+    assert(isBuilt);
+    sampleRegion = gfx_atlas_get_region(&atlas, sampleImage);
+    otherRegion = gfx_atlas_get_region(&atlas, otherImage);
+    textureSize.x = (float32_t)sampleRegion.width;
+    textureSize.y = (float32_t)sampleRegion.height;
     srand((uint32_t)time(NULL));
     vec2_t size = gfx_get_view_size();
     sprites[0].position.x = size.x * crappy_random();
@@ -68,21 +81,26 @@ void game_loop (float32_t dt) {
     gfx_set_clear_color(0.0f, 0.0f, 0.0f, 1.0f);
     
     gfx_set_pipeline(PIPELINE_TEXTURE);
-//    gfx_draw_texture(otherTexture, 0, 0);
+//    gfx_draw_texture_frame(otherRegion.texture, 0, 0, otherRegion.x, otherRegion.y, otherRegion.width, otherRegion.height);
     
     for (uint32_t index = 0; index < count; ++index) {
         Sprite* pSprite = &sprites[index];
         Frame frame = frames[pSprite->frame];
-        gfx_push_matrix();
-        gfx_translate(pSprite->position.x, pSprite->position.y);
-        gfx_rotate(pSprite->scaleRotation.y);
-        gfx_scale(pSprite->scaleRotation.x, pSprite->scaleRotation.x);
-        gfx_draw_texture_frame_with_color(sampleTexture, -frame.w / 2, -frame.h / 2, frame.x, frame.y, frame.w, frame.h, pSprite->color);
-        gfx_pop_matrix();
+        SpriteInstance* pInstance = &instances[index];
+        pInstance->position = pSprite->position;
+        pInstance->scale.x = pSprite->scaleRotation.x;
+        pInstance->scale.y = pSprite->scaleRotation.x;
+        pInstance->rotation = pSprite->scaleRotation.y;
+        pInstance->frameX = (uint16_t)(sampleRegion.x + frame.x);
+        pInstance->frameY = (uint16_t)(sampleRegion.y + frame.y);
+        pInstance->frameW = (uint16_t)frame.w;
+        pInstance->frameH = (uint16_t)frame.h;
+        pInstance->color = pSprite->color;
         pSprite->scaleRotation.y += pSprite->rotSpeed;
     }
+    gfx_draw_sprite_instances(sampleRegion.texture, instances, count);
     
-//    gfx_draw_texture_with_color(otherTexture, 200, 200, GET_COLOR_RGB_U32(0xff, 0, 0));
+//    gfx_draw_texture_frame_with_color(otherRegion.texture, 200, 200, otherRegion.x, otherRegion.y, otherRegion.width, otherRegion.height, GET_COLOR_RGB_U32(0xff, 0, 0));
     gfx_flush();
     
     if (input_pointer_hit(0)) {
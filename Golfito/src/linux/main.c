@@ -0,0 +1,107 @@
+#include "../game/boot.h"
+#include "../core/gfx.h"
+#include "../core/input.h"
+#include "../core/memory.h"
+#include "../config/config_gfx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ Headless runner for the software gfx backend. It loads sheet.png and image.png from the
+ working directory, so run it from assets/.
+
+ Build: cc -O2 -DTARGET_LINUX -o golfito_headless Golfito/src/linux/main.c Golfito/src/core/gfx_Software.c
+        Golfito/src/core/gfx_batch.c Golfito/src/core/gfx_atlas.c Golfito/src/core/input_Linux.c
+        Golfito/src/core/memory.c Golfito/src/core/memory_Linux.c Golfito/src/game/boot.c -lm -lpthread
+ usage: golfito_headless [frames] [taps] [output.ppm] [trace.bin]
+   frames  number of frames to run (default 600)
+   taps    number of scripted pointer taps, one every other frame, each spawning a sprite (default 0)
+   output  optional path where the last frame is written as a binary PPM
+   trace   optional path to record a memory trace to for mem_replay, needs MEM_ENABLE_TRACE=1
+*/
+
+extern void _input_update_down(uint32_t pointerID, float32_t x, float32_t y);
+extern void _input_update_up(uint32_t pointerID, float32_t x, float32_t y);
+extern void _gfx_software_initialize(float32_t width, float32_t height);
+extern void _gfx_software_get_framebuffer(const void** ppPixels, uint32_t* pWidth, uint32_t* pHeight);
+
+static float64_t _get_time_ms(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (float64_t)time.tv_sec * 1000.0 + (float64_t)time.tv_nsec / 1000000.0;
+}
+
+static void _write_ppm(const char* pPath) {
+    const void* pPixels = NULL;
+    uint32_t width = 0, height = 0;
+    _gfx_software_get_framebuffer(&pPixels, &width, &height);
+    FILE* pFile = fopen(pPath, "wb");
+    if (pFile == NULL) {
+        fprintf(stderr, "Failed to open %s\n", pPath);
+        return;
+    }
+    fprintf(pFile, "P6\n%u %u\n255\n", width, height);
+    const byte_t* pRGBA = (const byte_t*)pPixels;
+    for (uint32_t index = 0; index < width * height; ++index) {
+        fwrite(&pRGBA[index * 4], 1, 3, pFile);
+    }
+    fclose(pFile);
+}
+
+int main(int argc, char** argv) {
+    uint32_t frameCount = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : 600;
+    uint32_t tapCount = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : 0;
+    const char* pOutputPath = argc > 3 ? argv[3] : NULL;
+    const char* pTracePath = argc > 4 ? argv[4] : NULL;
+
+    game_sys_initialize();
+    if (!mem_initialize()) {
+        fprintf(stderr, "Failed to reserve memory for the allocators\n");
+        return 1;
+    }
+    if (pTracePath != NULL && !mem_trace_begin(pTracePath)) {
+        fprintf(stderr, "Can't record a memory trace to %s, build with MEM_ENABLE_TRACE=1\n", pTracePath);
+    }
+    _gfx_software_initialize((float32_t)GFX_DISPLAY_WIDTH, (float32_t)GFX_DISPLAY_HEIGHT);
+    gfx_initialize();
+    input_initialize();
+    game_start();
+
+    float64_t totalTime = 0.0;
+    float64_t worstTime = 0.0;
+    for (uint32_t frame = 0; frame < frameCount; ++frame) {
+        if (frame / 2 < tapCount) {
+            float32_t x = (float32_t)(rand() % GFX_DISPLAY_WIDTH);
+            float32_t y = (float32_t)(rand() % GFX_DISPLAY_HEIGHT);
+            if ((frame & 1) == 0) _input_update_down(0, x, y);
+            else _input_update_up(0, x, y);
+        }
+        float64_t start = _get_time_ms();
+        gfx_begin();
+        game_loop(0.16f);
+        gfx_end();
+        float64_t elapsed = _get_time_ms() - start;
+        totalTime += elapsed;
+        if (elapsed > worstTime) worstTime = elapsed;
+    }
+
+    if (frameCount > 0) {
+        GfxFrameStats stats = gfx_get_frame_stats();
+        printf("frames: %u avg: %.3f ms worst: %.3f ms\n", frameCount, totalTime / (float64_t)frameCount, worstTime);
+        printf("last frame: draws: %u batches: %u vertices: %u instances: %u points: %u flushes: %u (cap %u) pipeline switches: %u\n",
+               stats.drawCalls, stats.batches, stats.vertices, stats.instances, stats.points, stats.flushes, stats.capFlushes, stats.pipelineSwitches);
+    }
+    mem_dump_report(stdout);
+    if (pOutputPath != NULL) {
+        _write_ppm(pOutputPath);
+    }
+
+    game_end();
+    gfx_shutdown();
+    mem_trace_end();
+    mem_shutdown();
+    game_sys_shutdown();
+
+    return 0;
+}
@@ -0,0 +1,505 @@
+/*
+ Throughput of the math.h batch kernels, sinCos and the mat4 kernels against the functions
+ they replace. Each kernel is also checked against the scalar result, so a broken SIMD path
+ shows up as a non-zero error next to its timing. The mat4 kernels are checked against double
+ precision within ulp bounds, sinCos has to stay accurate past its range and on non-finite
+ arguments, and a fixed point simulation from fixed.h must reproduce the
+ same digest on every platform and compiler. The exit code is 1 when either check fails.
+ The instruction set is fixed at compile time, build once per ISA to compare them.
+
+ Build: cc -O2 -o math_bench Golfito/src/linux/math_bench.c -lm                     (SSE2 on x86-64, NEON on arm64)
+        cc -O2 -mavx2 -o math_bench_avx2 Golfito/src/linux/math_bench.c -lm
+        cc -O2 -DMATH_SIMD=0 -o math_bench_scalar Golfito/src/linux/math_bench.c -lm
+ Usage: math_bench [count] [iterations]
+*/
+#include "../core/types.h"
+#include "../core/math.h"
+#include "../core/fixed.h"
+#include "../core/utils.h"
+#include <float.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_COUNT 4096
+#define BENCH_DEFAULT_ITERATIONS 2000
+/* Digest of the fixed point replay in _check_fixed_replay, the same on every platform and compiler. */
+#define BENCH_FIXED_REPLAY_STEPS 100000
+#define BENCH_FIXED_REPLAY_DIGEST 0x1B80FC0717DC9FCCull
+/* Largest mat4 error allowed, in units in the last place of the largest element of the exact result. */
+#define BENCH_MAT4_MUL_ULPS 4.0
+#define BENCH_MAT4_INVERT_ULPS 64.0
+#define BENCH_MAT4_ORTHO_ULPS 2.0
+
+typedef struct {
+    uint32_t count;
+    uint32_t iterations;
+    mat2d_t matrix;
+    vec2_t* pPoints;
+    vec2_t* pPointsOut;
+    vec2_t* pPointsRef;
+    float32_t* pX;
+    float32_t* pY;
+    float32_t* pOutX;
+    float32_t* pOutY;
+    mat2d_t* pMatrices;
+    mat2d_t* pMatricesOut;
+    mat2d_t* pMatricesRef;
+    float32_t* pRadians;
+    float32_t* pSines;
+    float32_t* pCosines;
+    mat4_t* pMat4s;
+    mat4_t* pMat4sOut;
+    fixed_t* pFixedRadians;
+} Bench;
+
+static const char* _isa_name(void) {
+    switch (MATH_SIMD) {
+    case MATH_SIMD_SSE2: return "SSE2";
+    case MATH_SIMD_AVX2: return "AVX2";
+    case MATH_SIMD_NEON: return "NEON";
+    default: return "scalar";
+    }
+}
+
+static float64_t _now_ns(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (float64_t)time.tv_sec * 1e9 + (float64_t)time.tv_nsec;
+}
+
+static float32_t _random(void) {
+    return ((float32_t)rand() / (float32_t)RAND_MAX) * 2.0f - 1.0f;
+}
+
+static float32_t _max_error(const float32_t* pA, const float32_t* pB, size_t count) {
+    float32_t error = 0.0f;
+    for (size_t index = 0; index < count; ++index) {
+        float32_t difference = fabsf(pA[index] - pB[index]);
+        if (difference > error) error = difference;
+    }
+    return error;
+}
+
+static void _report(const char* pName, const Bench* pBench, float64_t elapsedNs, float32_t error, const char* pErrorUnit) {
+    float64_t elementsPerSecond = (float64_t)pBench->count * (float64_t)pBench->iterations / (elapsedNs * 1e-9);
+    printf("%-24s %10.1f M/s %10.3f ns/element   max error %g%s\n", pName, elementsPerSecond * 1e-6, 1e9 / elementsPerSecond, error, pErrorUnit);
+}
+
+static void _bench_points(Bench* pBench) {
+    float64_t start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            mat2DVec2Mul(&pBench->pPointsRef[index], &pBench->matrix, &pBench->pPoints[index]);
+        }
+    }
+    _report("mat2DVec2Mul loop", pBench, _now_ns() - start, 0.0f, "");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        mat2DVec2MulBatch(pBench->pPointsOut, &pBench->matrix, pBench->pPoints, pBench->count);
+    }
+    float32_t error = _max_error(&pBench->pPointsOut[0].x, &pBench->pPointsRef[0].x, (size_t)pBench->count * 2);
+    _report("mat2DVec2MulBatch", pBench, _now_ns() - start, error, "");
+
+    /* Four points at a time, the size of one quad. The batcher uses mat2DVec2Mul for those since this loses to it. */
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index + 4 <= pBench->count; index += 4) {
+            mat2DVec2MulBatch(&pBench->pPointsOut[index], &pBench->matrix, &pBench->pPoints[index], 4);
+        }
+    }
+    error = _max_error(&pBench->pPointsOut[0].x, &pBench->pPointsRef[0].x, (size_t)(pBench->count & ~3u) * 2);
+    _report("mat2DVec2MulBatch x4", pBench, _now_ns() - start, error, "");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        mat2DVec2MulBatchSoA(pBench->pOutX, pBench->pOutY, &pBench->matrix, pBench->pX, pBench->pY, pBench->count);
+    }
+    float32_t errorSoA = 0.0f;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        errorSoA = UT_MAX(errorSoA, fabsf(pBench->pOutX[index] - pBench->pPointsRef[index].x));
+        errorSoA = UT_MAX(errorSoA, fabsf(pBench->pOutY[index] - pBench->pPointsRef[index].y));
+    }
+    _report("mat2DVec2MulBatchSoA", pBench, _now_ns() - start, errorSoA, "");
+}
+
+static void _bench_matrices(Bench* pBench) {
+    float64_t start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            mat2dMul(&pBench->pMatricesRef[index], &pBench->pMatrices[index], &pBench->matrix);
+        }
+    }
+    _report("mat2dMul loop", pBench, _now_ns() - start, 0.0f, "");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        mat2dMulBatch(pBench->pMatricesOut, pBench->pMatrices, &pBench->matrix, pBench->count);
+    }
+    float32_t error = _max_error(pBench->pMatricesOut[0].data, pBench->pMatricesRef[0].data, (size_t)pBench->count * 6);
+    _report("mat2dMulBatch", pBench, _now_ns() - start, error, "");
+}
+
+/* The error of sinCos is measured against double precision, the others against the function they replace. */
+static float32_t _sincos_error(const Bench* pBench) {
+    float64_t error = 0.0;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        float64_t radian = (float64_t)pBench->pRadians[index];
+        error = UT_MAX(error, fabs((float64_t)pBench->pSines[index] - sin(radian)));
+        error = UT_MAX(error, fabs((float64_t)pBench->pCosines[index] - cos(radian)));
+    }
+    return (float32_t)error;
+}
+
+static void _bench_sincos(Bench* pBench) {
+    float64_t start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            pBench->pSines[index] = sinf(pBench->pRadians[index]);
+            pBench->pCosines[index] = cosf(pBench->pRadians[index]);
+        }
+    }
+    _report("sinf + cosf loop", pBench, _now_ns() - start, _sincos_error(pBench), "");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            sinCos(pBench->pRadians[index], &pBench->pSines[index], &pBench->pCosines[index]);
+        }
+    }
+    _report("sinCos loop", pBench, _now_ns() - start, _sincos_error(pBench), "");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        sinCosBatch(pBench->pSines, pBench->pCosines, pBench->pRadians, pBench->count);
+    }
+    _report("sinCosBatch", pBench, _now_ns() - start, _sincos_error(pBench), "");
+
+    /* Every element advances its own rotation by a fixed step, checked against the angle it should have reached. */
+    rot2_t* pRotations = (rot2_t*)malloc(sizeof(rot2_t) * pBench->count);
+    rot2_t* pSteps = (rot2_t*)malloc(sizeof(rot2_t) * pBench->count);
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        rot2Set(&pRotations[index], 0.0f);
+        rot2Set(&pSteps[index], pBench->pRadians[index] * 0.0001f);
+    }
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            rot2Advance(&pRotations[index], &pSteps[index]);
+        }
+    }
+    float64_t elapsed = _now_ns() - start;
+    float64_t driftError = 0.0;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        float64_t angle = atan2((float64_t)pSteps[index].s, (float64_t)pSteps[index].c) * (float64_t)pBench->iterations;
+        driftError = UT_MAX(driftError, fabs((float64_t)pRotations[index].c - cos(angle)));
+        driftError = UT_MAX(driftError, fabs((float64_t)pRotations[index].s - sin(angle)));
+    }
+    free(pRotations);
+    free(pSteps);
+    _report("rot2Advance", pBench, elapsed, (float32_t)driftError, "");
+}
+
+/*
+ Arguments past MATH_SINCOS_MAX_RADIAN and non-finite ones take the sinf and cosf fallback, in
+ sinCos and in every lane of sinCosBatch. Each one sits between in range values so the SIMD
+ paths see it mixed into a full register.
+*/
+static int32_t _check_sincos_edges(void) {
+    const float32_t kEdges[] = {
+        MATH_SINCOS_MAX_RADIAN, -MATH_SINCOS_MAX_RADIAN, 65536.01f, 1e6f, -3e9f, 3.4e9f, 1e10f, 1e30f,
+        FLT_MAX, -FLT_MAX, INFINITY, -INFINITY, NAN
+    };
+    const uint32_t edgeCount = (uint32_t)(sizeof(kEdges) / sizeof(kEdges[0]));
+    float32_t radians[sizeof(kEdges) / sizeof(kEdges[0]) * 3];
+    float32_t sines[sizeof(radians) / sizeof(radians[0])];
+    float32_t cosines[sizeof(radians) / sizeof(radians[0])];
+    const uint32_t count = edgeCount * 3;
+    for (uint32_t index = 0; index < count; ++index) {
+        radians[index] = (index % 3 == 1) ? kEdges[index / 3] : (float32_t)index * 0.37f - 5.0f;
+    }
+    sinCosBatch(sines, cosines, radians, count);
+    int32_t passed = 1;
+    for (uint32_t index = 0; index < count; ++index) {
+        float32_t radian = radians[index];
+        float32_t sn = 0.0f, cs = 0.0f;
+        sinCos(radian, &sn, &cs);
+        bool32_t isFinite = isfinite(radian);
+        /* Past 2^24 a float is a multiple of its spacing, so sin and cos of the double are still the exact reference. */
+        bool32_t isScalarOk = isFinite ? (fabs((float64_t)sn - sin((float64_t)radian)) <= 1e-6 && fabs((float64_t)cs - cos((float64_t)radian)) <= 1e-6)
+                                       : (isnan(sn) && isnan(cs));
+        bool32_t isBatchOk = isFinite ? (fabsf(sines[index] - sn) <= 1e-7f && fabsf(cosines[index] - cs) <= 1e-7f)
+                                      : (isnan(sines[index]) && isnan(cosines[index]));
+        if (!isScalarOk || !isBatchOk) {
+            printf("FAIL sinCos(%g) = (%g, %g), sinCosBatch (%g, %g), exact (%g, %g)\n", radian, sn, cs, sines[index], cosines[index],
+                   sin((float64_t)radian), cos((float64_t)radian));
+            passed = 0;
+        }
+    }
+    printf("%-24s %s\n", "sinCos edge cases", passed ? "ok" : "failed");
+    return passed;
+}
+
+/* Error of a mat4 against its exact value, in ulps of the result's largest element so small entries don't dominate. */
+static float64_t _mat4_ulps(const mat4_t* pResult, const float64_t* pExact) {
+    float64_t largest = 0.0;
+    for (uint32_t index = 0; index < 16; ++index) {
+        largest = UT_MAX(largest, fabs(pExact[index]));
+    }
+    float64_t ulp = largest > 0.0 ? ldexp(1.0, ilogb(largest) - 23) : ldexp(1.0, -149);
+    float64_t error = 0.0;
+    for (uint32_t index = 0; index < 16; ++index) {
+        error = UT_MAX(error, fabs((float64_t)pResult->data[index] - pExact[index]) / ulp);
+    }
+    return error;
+}
+
+static void _mat4_mul_exact(float64_t* pOut, const mat4_t* pM0, const mat4_t* pM1) {
+    for (uint32_t row = 0; row < 4; ++row) {
+        for (uint32_t column = 0; column < 4; ++column) {
+            float64_t sum = 0.0;
+            for (uint32_t k = 0; k < 4; ++k) {
+                sum += (float64_t)pM1->data[row * 4 + k] * (float64_t)pM0->data[k * 4 + column];
+            }
+            pOut[row * 4 + column] = sum;
+        }
+    }
+}
+
+/* Gauss-Jordan with partial pivoting in double precision. */
+static void _mat4_invert_exact(float64_t* pOut, const mat4_t* pM) {
+    float64_t work[4][8];
+    for (uint32_t row = 0; row < 4; ++row) {
+        for (uint32_t column = 0; column < 4; ++column) {
+            work[row][column] = (float64_t)pM->data[row * 4 + column];
+            work[row][column + 4] = row == column ? 1.0 : 0.0;
+        }
+    }
+    for (uint32_t column = 0; column < 4; ++column) {
+        uint32_t pivot = column;
+        for (uint32_t row = column + 1; row < 4; ++row) {
+            if (fabs(work[row][column]) > fabs(work[pivot][column])) pivot = row;
+        }
+        for (uint32_t k = 0; k < 8; ++k) {
+            float64_t swap = work[column][k];
+            work[column][k] = work[pivot][k];
+            work[pivot][k] = swap;
+        }
+        float64_t scale = 1.0 / work[column][column];
+        for (uint32_t k = 0; k < 8; ++k) work[column][k] *= scale;
+        for (uint32_t row = 0; row < 4; ++row) {
+            if (row == column) continue;
+            float64_t factor = work[row][column];
+            for (uint32_t k = 0; k < 8; ++k) work[row][k] -= factor * work[column][k];
+        }
+    }
+    for (uint32_t row = 0; row < 4; ++row) {
+        for (uint32_t column = 0; column < 4; ++column) {
+            pOut[row * 4 + column] = work[row][column + 4];
+        }
+    }
+}
+
+static int32_t _check(const char* pName, float64_t ulps, float64_t bound) {
+    if (ulps <= bound) return 1;
+    printf("FAIL %s is %.1f ulps off, the bound is %.1f\n", pName, ulps, bound);
+    return 0;
+}
+
+/* Returns 0 when a kernel is outside its ulp bound. */
+static int32_t _bench_mat4(Bench* pBench) {
+    float64_t exact[16];
+    float64_t mulUlps = 0.0, invertUlps = 0.0, orthoUlps = 0.0;
+
+    float64_t start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index + 1 < pBench->count; ++index) {
+            mat4Mul(&pBench->pMat4sOut[index], &pBench->pMat4s[index], &pBench->pMat4s[index + 1]);
+        }
+    }
+    float64_t elapsed = _now_ns() - start;
+    for (uint32_t index = 0; index + 1 < pBench->count; ++index) {
+        _mat4_mul_exact(exact, &pBench->pMat4s[index], &pBench->pMat4s[index + 1]);
+        mulUlps = UT_MAX(mulUlps, _mat4_ulps(&pBench->pMat4sOut[index], exact));
+    }
+    _report("mat4Mul", pBench, elapsed, (float32_t)mulUlps, " ulps");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            mat4Invert(&pBench->pMat4sOut[index], &pBench->pMat4s[index]);
+        }
+    }
+    elapsed = _now_ns() - start;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        _mat4_invert_exact(exact, &pBench->pMat4s[index]);
+        invertUlps = UT_MAX(invertUlps, _mat4_ulps(&pBench->pMat4sOut[index], exact));
+    }
+    _report("mat4Invert", pBench, elapsed, (float32_t)invertUlps, " ulps");
+
+    start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            const float32_t* pView = pBench->pMat4s[index].data;
+            mat4Orthographic(&pBench->pMat4sOut[index], pView[0], pView[0] + 800.0f, pView[1] + 600.0f, pView[1], -100.0f, 100.0f);
+        }
+    }
+    elapsed = _now_ns() - start;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        const float32_t* pView = pBench->pMat4s[index].data;
+        float64_t left = pView[0], right = (float64_t)(pView[0] + 800.0f);
+        float64_t bottom = (float64_t)(pView[1] + 600.0f), top = pView[1];
+        memset(exact, 0, sizeof(exact));
+        exact[0] = 2.0 / (right - left);
+        exact[5] = 2.0 / (top - bottom);
+        exact[10] = -2.0 / 200.0;
+        exact[12] = -(right + left) / (right - left);
+        exact[13] = -(top + bottom) / (top - bottom);
+        exact[14] = 0.0;
+        exact[15] = 1.0;
+        orthoUlps = UT_MAX(orthoUlps, _mat4_ulps(&pBench->pMat4sOut[index], exact));
+    }
+    _report("mat4Orthographic", pBench, elapsed, (float32_t)orthoUlps, " ulps");
+
+    int32_t passed = _check("mat4Mul", mulUlps, BENCH_MAT4_MUL_ULPS);
+    passed &= _check("mat4Invert", invertUlps, BENCH_MAT4_INVERT_ULPS);
+    passed &= _check("mat4Orthographic", orthoUlps, BENCH_MAT4_ORTHO_ULPS);
+    return passed;
+}
+
+static uint64_t _fnv1a(uint64_t hash, const void* pData, size_t size) {
+    const byte_t* pBytes = (const byte_t*)pData;
+    for (size_t index = 0; index < size; ++index) {
+        hash = (hash ^ pBytes[index]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+/*
+ A spinning ball rolling with friction and bouncing off the walls of a 800x600 course, all in fixed point.
+ Hashing every step exercises the whole fixed.h API, any platform difference changes the digest.
+*/
+static uint64_t _fixed_replay(void) {
+    fxvec2_t position = { FX_FROM_INT(400), FX_FROM_INT(300) };
+    fxvec2_t velocity = { FX_FROM_INT(7), FX_FROM_INT(-3) };
+    fixed_t spin = FX_ONE / 50;
+    fixed_t friction = FX_ONE - FX_ONE / 2000;
+    fxmat2d_t identity;
+    fxmat2dIdent(&identity);
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint32_t step = 0; step < BENCH_FIXED_REPLAY_STEPS; ++step) {
+        fxmat2d_t curve = identity;
+        fxmat2DRotate(&curve, &identity, fxMul(spin, FX_ONE / 8));
+        fxvec2_t curved;
+        fxmat2DVec2Mul(&curved, &curve, &velocity);
+        fxvec2Scale(&velocity, &curved, friction);
+        fxvec2_t next;
+        fxvec2Add(&next, &position, &velocity);
+        position = next;
+        if (position.x < 0 || position.x > FX_FROM_INT(800)) velocity.x = -velocity.x;
+        if (position.y < 0 || position.y > FX_FROM_INT(600)) velocity.y = -velocity.y;
+        /* Kick the ball towards the centre whenever it nearly stops. */
+        if (fxvec2Length(&velocity) < FX_ONE / 4) {
+            fxvec2_t centre = { FX_FROM_INT(400), FX_FROM_INT(300) };
+            fxvec2_t offset, direction;
+            fxvec2Sub(&offset, &centre, &position);
+            fxvec2Normalize(&direction, &offset);
+            fxvec2Scale(&velocity, &direction, FX_FROM_INT(6));
+            spin = -spin + fxDiv(fxvec2Distance(&centre, &position), FX_FROM_INT(20000));
+        }
+        spin = fxMul(spin, FX_ONE - FX_ONE / 500) + fxSqrt(FX_ONE / 1000000 + (fixed_t)(step & 7));
+        hash = _fnv1a(hash, &position, sizeof(position));
+        hash = _fnv1a(hash, &velocity, sizeof(velocity));
+        hash = _fnv1a(hash, &spin, sizeof(spin));
+    }
+    return hash;
+}
+
+/* Returns 0 when the fixed point replay doesn't reproduce the reference digest. */
+static int32_t _bench_fixed(Bench* pBench) {
+    float64_t start = _now_ns();
+    for (uint32_t iteration = 0; iteration < pBench->iterations; ++iteration) {
+        for (uint32_t index = 0; index < pBench->count; ++index) {
+            fixed_t sn, cs;
+            fxSinCos(pBench->pFixedRadians[index], &sn, &cs);
+            pBench->pSines[index] = fxToFloat(sn);
+            pBench->pCosines[index] = fxToFloat(cs);
+        }
+    }
+    float64_t elapsed = _now_ns() - start;
+    float64_t error = 0.0;
+    for (uint32_t index = 0; index < pBench->count; ++index) {
+        float64_t radian = (float64_t)pBench->pFixedRadians[index] / (float64_t)FX_ONE;
+        error = UT_MAX(error, fabs((float64_t)pBench->pSines[index] - sin(radian)));
+        error = UT_MAX(error, fabs((float64_t)pBench->pCosines[index] - cos(radian)));
+    }
+    _report("fxSinCos", pBench, elapsed, (float32_t)error, "");
+
+    start = _now_ns();
+    uint64_t digest = _fixed_replay();
+    elapsed = _now_ns() - start;
+    printf("%-24s %10.1f M/s %10.3f ns/step      digest %016" PRIx64 "\n", "fixed replay",
+           BENCH_FIXED_REPLAY_STEPS / (elapsed * 1e-9) * 1e-6, elapsed / BENCH_FIXED_REPLAY_STEPS, digest);
+    if (digest == BENCH_FIXED_REPLAY_DIGEST) return 1;
+    printf("FAIL fixed replay digest is %016" PRIx64 ", expected %016" PRIx64 "\n", digest, (uint64_t)BENCH_FIXED_REPLAY_DIGEST);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    Bench bench = { 0 };
+    bench.count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_COUNT;
+    bench.iterations = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_ITERATIONS;
+    if (bench.count == 0 || bench.iterations == 0) {
+        fprintf(stderr, "usage: %s [count] [iterations]\n", argv[0]);
+        return 1;
+    }
+    srand(1);
+    bench.pPoints = (vec2_t*)malloc(sizeof(vec2_t) * bench.count);
+    bench.pPointsOut = (vec2_t*)malloc(sizeof(vec2_t) * bench.count);
+    bench.pPointsRef = (vec2_t*)malloc(sizeof(vec2_t) * bench.count);
+    bench.pX = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pY = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pOutX = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pOutY = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pMatrices = (mat2d_t*)malloc(sizeof(mat2d_t) * bench.count);
+    bench.pMatricesOut = (mat2d_t*)malloc(sizeof(mat2d_t) * bench.count);
+    bench.pMatricesRef = (mat2d_t*)malloc(sizeof(mat2d_t) * bench.count);
+    bench.pRadians = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pSines = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pCosines = (float32_t*)malloc(sizeof(float32_t) * bench.count);
+    bench.pMat4s = (mat4_t*)malloc(sizeof(mat4_t) * bench.count);
+    bench.pMat4sOut = (mat4_t*)malloc(sizeof(mat4_t) * bench.count);
+    bench.pFixedRadians = (fixed_t*)malloc(sizeof(fixed_t) * bench.count);
+    for (uint32_t index = 0; index < bench.count; ++index) {
+        bench.pPoints[index].x = bench.pX[index] = _random() * 400.0f;
+        bench.pPoints[index].y = bench.pY[index] = _random() * 400.0f;
+        for (uint32_t element = 0; element < 6; ++element) {
+            bench.pMatrices[index].data[element] = _random();
+        }
+        bench.pRadians[index] = _random() * 100.0f;
+        bench.pFixedRadians[index] = (fixed_t)(rand() % (FX_ONE * 200)) - FX_ONE * 100;
+        /* Twice the identity plus terms below 0.5, well conditioned enough that inverting loses little. */
+        for (uint32_t element = 0; element < 16; ++element) {
+            bench.pMat4s[index].data[element] = _random() * 0.5f + (element % 5 == 0 ? 2.0f : 0.0f);
+        }
+    }
+    mat2d_t identity;
+    mat2dIdent(&identity);
+    bench.matrix = identity;
+    mat2DRotate(&bench.matrix, &identity, 0.7f);
+    bench.matrix.a *= 1.5f;
+    bench.matrix.d *= 0.75f;
+    bench.matrix.tx = 320.0f;
+    bench.matrix.ty = 240.0f;
+
+    printf("%s, %u elements x %u iterations\n", _isa_name(), bench.count, bench.iterations);
+    _bench_points(&bench);
+    _bench_matrices(&bench);
+    _bench_sincos(&bench);
+    int32_t passed = _check_sincos_edges();
+    passed &= _bench_mat4(&bench);
+    passed &= _bench_fixed(&bench);
+    return passed ? 0 : 1;
+}
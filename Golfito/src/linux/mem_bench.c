@@ -0,0 +1,258 @@
+/*
+ Pool lookup costs before and after the pools moved to bit scanned size classes and
+ fixed-stride regions. Both versions are modelled here with the same free stacks, so
+ the timings only differ by how a size finds its class and a pointer finds its pool:
+ the table scan with a range check of every pool, against a bit scan and a shift.
+ Every size is also checked to land in the same class under both, and the heap of
+ core/memory.c has to serve every size just under a commit granule on a fresh heap,
+ which needs its growth to cover the bin rounding of the search. The exit code is 1
+ when a check fails.
+
+ Build: cc -O2 -DTARGET_LINUX -o mem_bench Golfito/src/linux/mem_bench.c Golfito/src/core/memory.c Golfito/src/core/memory_Linux.c -lpthread
+ Usage: mem_bench [count] [iterations]
+*/
+#include "../core/types.h"
+#include "../core/utils.h"
+#include "../core/memory.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_COUNT 20000
+#define BENCH_DEFAULT_ITERATIONS 200
+#define BENCH_MAX_SIZE 1024
+#define BENCH_TIMING_RUNS 3
+/* The 64 bit pool table of memory.c before the change, every pool its own allocation. */
+#define BENCH_POOL_COUNT 8
+#define BENCH_POOL_MIN_SIZE_SHIFT 3
+#define BENCH_POOL_REGION_SHIFT 24
+#define BENCH_POOL_REGION_SIZE ((size_t)1 << BENCH_POOL_REGION_SHIFT)
+/* Mirrors the heap commit granule of memory.c without huge pages. */
+#define BENCH_HEAP_GRANULE ((size_t)UT_MB(1))
+#define BENCH_HEAP_CHECK_SPAN ((size_t)UT_KB(8))
+#define BENCH_HEAP_CHECK_GRANULES 4
+
+static const size_t kPoolSizes[BENCH_POOL_COUNT] = { 8, 16, 32, 64, 128, 256, 512, 1024 };
+static const size_t kPoolCapacities[BENCH_POOL_COUNT] = { UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(1), UT_MB(2), UT_MB(4), UT_MB(8), UT_MB(16) };
+
+typedef struct {
+    void** pFreeAddresses;
+    uint32_t freeCount;
+    void* pHead;
+    void* pCurr;
+    void* pTail;
+    size_t elementSize;
+    size_t byteSize;
+} BenchPool;
+
+typedef struct {
+    byte_t* pRegion;
+    BenchPool pools[BENCH_POOL_COUNT];
+} BenchPools;
+
+typedef struct {
+    const char* pName;
+    uint32_t (*classOf)(size_t size);
+    void* (*alloc)(BenchPools* pPools, size_t size);
+    void (*free)(BenchPools* pPools, void* p);
+} BenchLookup;
+
+static float64_t _now_ns(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (float64_t)time.tv_sec * 1e9 + (float64_t)time.tv_nsec;
+}
+
+/* Separate pools for the scan, one reserved range at a fixed stride for the bit scan. */
+static bool32_t _pools_create(BenchPools* pPools, bool32_t isStrided) {
+    memset(pPools, 0, sizeof(BenchPools));
+    if (isStrided) {
+        pPools->pRegion = (byte_t*)malloc(BENCH_POOL_REGION_SIZE * BENCH_POOL_COUNT);
+        if (pPools->pRegion == NULL) return UT_FALSE;
+    }
+    for (uint32_t index = 0; index < BENCH_POOL_COUNT; ++index) {
+        BenchPool* pPool = &pPools->pools[index];
+        pPool->elementSize = kPoolSizes[index];
+        pPool->byteSize = kPoolCapacities[index];
+        pPool->pHead = isStrided ? (void*)(pPools->pRegion + index * BENCH_POOL_REGION_SIZE) : malloc(pPool->byteSize);
+        pPool->pFreeAddresses = (void**)malloc(sizeof(void*) * (pPool->byteSize / pPool->elementSize));
+        if (pPool->pHead == NULL || pPool->pFreeAddresses == NULL) return UT_FALSE;
+        pPool->pCurr = pPool->pHead;
+        pPool->pTail = UT_FORWARD_POINTER(pPool->pHead, pPool->byteSize);
+    }
+    return UT_TRUE;
+}
+
+static void _pools_destroy(BenchPools* pPools, bool32_t isStrided) {
+    for (uint32_t index = 0; index < BENCH_POOL_COUNT; ++index) {
+        if (!isStrided) free(pPools->pools[index].pHead);
+        free(pPools->pools[index].pFreeAddresses);
+    }
+    free(pPools->pRegion);
+}
+
+static void* _pool_take(BenchPool* pPool) {
+    if (pPool->freeCount > 0) return pPool->pFreeAddresses[--pPool->freeCount];
+    if (UT_POINTER_TO_UINT(pPool->pCurr) >= UT_POINTER_TO_UINT(pPool->pTail)) return NULL;
+    void* pAddress = pPool->pCurr;
+    pPool->pCurr = UT_FORWARD_POINTER(pAddress, pPool->elementSize);
+    return pAddress;
+}
+
+/* Rounds up to a power of two and walks the size table from whichever end is closer. */
+static uint32_t _scan_class(size_t size) {
+    if (size < kPoolSizes[0]) size = kPoolSizes[0];
+    UT_ROUND_POT(size);
+    if (size > kPoolSizes[BENCH_POOL_COUNT - 1]) return BENCH_POOL_COUNT;
+    uint32_t poolIndex = 0;
+    if (size < kPoolSizes[BENCH_POOL_COUNT / 2]) {
+        for (poolIndex = 0; poolIndex < BENCH_POOL_COUNT; ++poolIndex) {
+            if (size == kPoolSizes[poolIndex]) break;
+        }
+    } else {
+        for (poolIndex = BENCH_POOL_COUNT - 1; poolIndex > 0; --poolIndex) {
+            if (size == kPoolSizes[poolIndex]) break;
+        }
+    }
+    return poolIndex;
+}
+
+static void* _scan_alloc(BenchPools* pPools, size_t size) {
+    uint32_t poolIndex = _scan_class(size);
+    return poolIndex < BENCH_POOL_COUNT ? _pool_take(&pPools->pools[poolIndex]) : NULL;
+}
+
+/* Range checks every pool in order until one holds the pointer. */
+static void _scan_free(BenchPools* pPools, void* p) {
+    for (uint32_t index = 0; index < BENCH_POOL_COUNT; ++index) {
+        BenchPool* pPool = &pPools->pools[index];
+        if (UT_IN_RANGE(p, pPool->pHead, UT_FORWARD_POINTER(pPool->pHead, pPool->byteSize))) {
+            pPool->pFreeAddresses[pPool->freeCount++] = p;
+            return;
+        }
+    }
+}
+
+static uint32_t _bit_scan_class(size_t size) {
+    if (size > kPoolSizes[BENCH_POOL_COUNT - 1]) return BENCH_POOL_COUNT;
+    if (size < kPoolSizes[0]) size = kPoolSizes[0];
+    return UT_BIT_SCAN_REVERSE(size - 1) + 1 - BENCH_POOL_MIN_SIZE_SHIFT;
+}
+
+static void* _bit_scan_alloc(BenchPools* pPools, size_t size) {
+    uint32_t poolIndex = _bit_scan_class(size);
+    return poolIndex < BENCH_POOL_COUNT ? _pool_take(&pPools->pools[poolIndex]) : NULL;
+}
+
+/* The owner is the pointer's offset into the range divided by the stride. */
+static void _stride_free(BenchPools* pPools, void* p) {
+    size_t poolIndex = (UT_POINTER_TO_UINT(p) - UT_POINTER_TO_UINT(pPools->pRegion)) >> BENCH_POOL_REGION_SHIFT;
+    BenchPool* pPool = &pPools->pools[poolIndex];
+    pPool->pFreeAddresses[pPool->freeCount++] = p;
+}
+
+/* Allocates every size, then frees them in shuffled order, and returns the best run's ns per pair. */
+static float64_t _bench_lookup(const BenchLookup* pLookup, bool32_t isStrided, const size_t* pSizes, const uint32_t* pFreeOrder, void** pAddresses, uint32_t count, uint32_t iterations) {
+    BenchPools pools;
+    if (!_pools_create(&pools, isStrided)) {
+        fprintf(stderr, "Failed to allocate the %s pools\n", pLookup->pName);
+        _pools_destroy(&pools, isStrided);
+        return -1.0;
+    }
+    float64_t best = 0.0;
+    for (uint32_t run = 0; run < BENCH_TIMING_RUNS; ++run) {
+        float64_t start = _now_ns();
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+            for (uint32_t index = 0; index < count; ++index) {
+                pAddresses[index] = pLookup->alloc(&pools, pSizes[index]);
+            }
+            for (uint32_t index = 0; index < count; ++index) {
+                pLookup->free(&pools, pAddresses[pFreeOrder[index]]);
+            }
+        }
+        float64_t elapsed = (_now_ns() - start) / ((float64_t)count * iterations);
+        best = (run == 0 || elapsed < best) ? elapsed : best;
+    }
+    _pools_destroy(&pools, isStrided);
+    return best;
+}
+
+/* Each size gets a fresh heap, so the first allocation always has to grow it. */
+static int32_t _check_heap_growth(void) {
+    uint32_t failures = 0;
+    for (size_t granules = 1; granules <= BENCH_HEAP_CHECK_GRANULES; ++granules) {
+        for (size_t size = granules * BENCH_HEAP_GRANULE - BENCH_HEAP_CHECK_SPAN; size <= granules * BENCH_HEAP_GRANULE; size += 16) {
+            if (!mem_initialize()) {
+                fprintf(stderr, "Failed to initialize the allocators\n");
+                return 0;
+            }
+            if (mem_heap_alloc(size, 16) == NULL) {
+                if (failures++ == 0) printf("FAIL mem_heap_alloc(%zu) returned NULL on a fresh heap\n", size);
+            }
+            mem_shutdown();
+        }
+    }
+    if (failures > 0) printf("FAIL %u fresh heap allocations just under a commit granule failed\n", failures);
+    return failures == 0;
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc > 1 ? (uint32_t)strtoul(argv[1], NULL, 10) : BENCH_DEFAULT_COUNT;
+    uint32_t iterations = argc > 2 ? (uint32_t)strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_ITERATIONS;
+    if (count == 0 || iterations == 0) {
+        fprintf(stderr, "usage: %s [count] [iterations]\n", argv[0]);
+        return 1;
+    }
+    const BenchLookup kScan = { "table scan + range check", &_scan_class, &_scan_alloc, &_scan_free };
+    const BenchLookup kBitScan = { "bit scan + stride", &_bit_scan_class, &_bit_scan_alloc, &_stride_free };
+
+    int32_t passed = 1;
+    for (size_t size = 1; size <= BENCH_MAX_SIZE + 1; ++size) {
+        if (kScan.classOf(size) != kBitScan.classOf(size)) {
+            printf("FAIL size %zu is class %u by table scan and %u by bit scan\n", size, kScan.classOf(size), kBitScan.classOf(size));
+            passed = 0;
+        }
+    }
+    passed &= _check_heap_growth();
+
+    srand(1);
+    size_t* pSizes = (size_t*)malloc(sizeof(size_t) * count);
+    uint32_t* pFreeOrder = (uint32_t*)malloc(sizeof(uint32_t) * count);
+    void** pAddresses = (void**)malloc(sizeof(void*) * count);
+    if (pSizes == NULL || pFreeOrder == NULL || pAddresses == NULL) {
+        fprintf(stderr, "Failed to allocate the workload\n");
+        return 1;
+    }
+    size_t classCounts[BENCH_POOL_COUNT] = { 0 };
+    for (uint32_t index = 0; index < count; ++index) {
+        pSizes[index] = (size_t)(rand() % BENCH_MAX_SIZE) + 1;
+        pFreeOrder[index] = index;
+        classCounts[_bit_scan_class(pSizes[index])] += 1;
+    }
+    /* Every block is live at once before the frees, so each class has to fit its pool. */
+    for (uint32_t index = 0; index < BENCH_POOL_COUNT; ++index) {
+        if (classCounts[index] > kPoolCapacities[index] / kPoolSizes[index]) {
+            fprintf(stderr, "%u sizes overflow the %zu byte pool, use a smaller count\n", count, kPoolSizes[index]);
+            return 1;
+        }
+    }
+    for (uint32_t index = count - 1; index > 0; --index) {
+        uint32_t other = (uint32_t)rand() % (index + 1);
+        uint32_t swap = pFreeOrder[index];
+        pFreeOrder[index] = pFreeOrder[other];
+        pFreeOrder[other] = swap;
+    }
+
+    printf("%u random sizes of 1-%u bytes x %u iterations, best of %u runs\n", count, BENCH_MAX_SIZE, iterations, BENCH_TIMING_RUNS);
+    float64_t scanNs = _bench_lookup(&kScan, UT_FALSE, pSizes, pFreeOrder, pAddresses, count, iterations);
+    float64_t bitScanNs = _bench_lookup(&kBitScan, UT_TRUE, pSizes, pFreeOrder, pAddresses, count, iterations);
+    if (scanNs < 0.0 || bitScanNs < 0.0) return 1;
+    printf("%-26s %8.2f ns per alloc/free pair\n", kScan.pName, scanNs);
+    printf("%-26s %8.2f ns per alloc/free pair   %.1fx\n", kBitScan.pName, bitScanNs, scanNs / bitScanNs);
+
+    free(pSizes);
+    free(pFreeOrder);
+    free(pAddresses);
+    return passed ? 0 : 1;
+}
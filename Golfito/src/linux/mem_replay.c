@@ -0,0 +1,387 @@
+/*
+ Offline replay of allocation traces recorded with mem_trace_begin (MEM_ENABLE_TRACE).
+ Every candidate pool table, a power of two range of size classes with the heap above
+ it, is run against the trace to measure its peak footprint, internal fragmentation and
+ alloc/free latency. The table with the smallest footprint is written as a header for
+ MEM_POOL_TABLE (see config_mem.h).
+
+ Build: cc -O2 -o mem_replay Golfito/src/linux/mem_replay.c
+ Usage: mem_replay trace.bin [config_mem_pools.h]
+*/
+#include "../core/memory_trace.h"
+#include "../core/utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define REPLAY_MIN_SHIFT_FIRST 3
+#define REPLAY_MIN_SHIFT_LAST 6
+#define REPLAY_MAX_SHIFT_LAST 14
+#define REPLAY_MAX_CLASSES 16
+#define REPLAY_MAX_LINEAR_CONTEXTS 16
+/* Mirrors the pool commit granule and the heap's block header and alignment in memory.c. */
+#define REPLAY_POOL_GRANULE ((uint64_t)UT_KB(64))
+#define REPLAY_HEAP_HEADER 16
+#define REPLAY_HEAP_ALIGNMENT 16
+/* Candidates within this many bytes of the smallest footprint are ranked by latency. */
+#define REPLAY_FOOTPRINT_SLACK ((uint64_t)UT_KB(64))
+#define REPLAY_TIMING_RUNS 3
+
+typedef struct {
+    uint64_t address;
+    uint32_t size;
+    uint32_t slot;
+} LiveEntry;
+
+/* Open addressing map from a live address to its requested size and replay slot. */
+typedef struct {
+    LiveEntry* pEntries;
+    uint32_t capacity;
+} LiveMap;
+
+typedef struct {
+    uint32_t minShift;
+    uint32_t maxShift;
+    uint64_t classPeakBlocks[REPLAY_MAX_CLASSES];
+    uint64_t poolFootprint;
+    uint64_t heapPeak;
+    uint64_t footprint;
+    uint64_t requestedBytes;
+    uint64_t allocatedBytes;
+    float64_t nsPerOp;
+} Candidate;
+
+typedef struct {
+    uint64_t address;
+    uint64_t peak;
+} LinearPeak;
+
+typedef struct {
+    MemTraceHeader header;
+    MemTraceRecord* pRecords;
+    uint32_t count;
+    /* Per record, a dense slot shared by an alloc and its free, and the alloc's requested size. */
+    uint32_t* pSlots;
+    uint32_t* pSizes;
+    uint32_t slotCount;
+    uint32_t allocCount;
+    uint32_t frameCount;
+} Trace;
+
+static uint64_t _hash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return key;
+}
+
+static LiveEntry* _live_find(LiveMap* pMap, uint64_t address) {
+    uint32_t mask = pMap->capacity - 1;
+    uint32_t index = (uint32_t)_hash(address) & mask;
+    while (pMap->pEntries[index].address != 0 && pMap->pEntries[index].address != address) {
+        index = (index + 1) & mask;
+    }
+    return &pMap->pEntries[index];
+}
+
+/* Backward shift deletion keeps probe chains intact without tombstones. */
+static void _live_remove(LiveMap* pMap, LiveEntry* pEntry) {
+    uint32_t mask = pMap->capacity - 1;
+    uint32_t hole = (uint32_t)(pEntry - pMap->pEntries);
+    uint32_t index = (hole + 1) & mask;
+    while (pMap->pEntries[index].address != 0) {
+        uint32_t home = (uint32_t)_hash(pMap->pEntries[index].address) & mask;
+        if (((index - home) & mask) >= ((index - hole) & mask)) {
+            pMap->pEntries[hole] = pMap->pEntries[index];
+            hole = index;
+        }
+        index = (index + 1) & mask;
+    }
+    pMap->pEntries[hole].address = 0;
+}
+
+static int32_t _is_alloc(uint8_t op) {
+    return op == MEM_TRACE_POOL_ALLOC || op == MEM_TRACE_HEAP_ALLOC;
+}
+
+static int32_t _is_free(uint8_t op) {
+    return op == MEM_TRACE_POOL_FREE || op == MEM_TRACE_HEAP_FREE;
+}
+
+static int32_t _load_trace(const char* pPath, Trace* pTrace) {
+    FILE* pFile = fopen(pPath, "rb");
+    if (pFile == NULL) {
+        fprintf(stderr, "Can't open %s\n", pPath);
+        return 0;
+    }
+    fseek(pFile, 0, SEEK_END);
+    long fileSize = ftell(pFile);
+    fseek(pFile, 0, SEEK_SET);
+    if (fileSize < (long)sizeof(MemTraceHeader) || fread(&pTrace->header, sizeof(MemTraceHeader), 1, pFile) != 1 ||
+        pTrace->header.magic != MEM_TRACE_MAGIC || pTrace->header.version != MEM_TRACE_VERSION) {
+        fprintf(stderr, "%s is not a version %u memory trace\n", pPath, MEM_TRACE_VERSION);
+        fclose(pFile);
+        return 0;
+    }
+    pTrace->count = (uint32_t)((fileSize - (long)sizeof(MemTraceHeader)) / (long)sizeof(MemTraceRecord));
+    pTrace->pRecords = (MemTraceRecord*)malloc(sizeof(MemTraceRecord) * UT_MAX(pTrace->count, 1u));
+    pTrace->count = (uint32_t)fread(pTrace->pRecords, sizeof(MemTraceRecord), pTrace->count, pFile);
+    fclose(pFile);
+    return 1;
+}
+
+/*
+ Pairs every free with its alloc once, so candidates replay from plain arrays. Allocs reuse
+ freed slots, which bounds the slot table by the peak live count.
+*/
+static void _resolve_trace(Trace* pTrace) {
+    LiveMap map;
+    map.capacity = 1024;
+    while (map.capacity < pTrace->count * 2) map.capacity <<= 1;
+    map.pEntries = (LiveEntry*)calloc(map.capacity, sizeof(LiveEntry));
+    uint32_t* pFreeSlots = (uint32_t*)malloc(sizeof(uint32_t) * UT_MAX(pTrace->count, 1u));
+    uint32_t freeSlotCount = 0;
+    pTrace->pSlots = (uint32_t*)malloc(sizeof(uint32_t) * UT_MAX(pTrace->count, 1u));
+    pTrace->pSizes = (uint32_t*)malloc(sizeof(uint32_t) * UT_MAX(pTrace->count, 1u));
+    pTrace->slotCount = 0;
+    pTrace->allocCount = 0;
+    pTrace->frameCount = 0;
+    for (uint32_t index = 0; index < pTrace->count; ++index) {
+        const MemTraceRecord* pRecord = &pTrace->pRecords[index];
+        pTrace->pSlots[index] = UINT32_MAX;
+        pTrace->pSizes[index] = 0;
+        pTrace->frameCount = UT_MAX(pTrace->frameCount, pRecord->frame);
+        if (_is_alloc(pRecord->op)) {
+            uint32_t slot = freeSlotCount > 0 ? pFreeSlots[--freeSlotCount] : pTrace->slotCount++;
+            LiveEntry* pEntry = _live_find(&map, pRecord->address);
+            pEntry->address = pRecord->address;
+            pEntry->size = pRecord->size;
+            pEntry->slot = slot;
+            pTrace->pSlots[index] = slot;
+            pTrace->pSizes[index] = pRecord->size;
+            pTrace->allocCount++;
+        } else if (_is_free(pRecord->op)) {
+            LiveEntry* pEntry = _live_find(&map, pRecord->address);
+            if (pEntry->address == 0) continue; /* allocated before the trace began */
+            pTrace->pSlots[index] = pEntry->slot;
+            pTrace->pSizes[index] = pEntry->size;
+            pFreeSlots[freeSlotCount++] = pEntry->slot;
+            _live_remove(&map, pEntry);
+        }
+    }
+    free(pFreeSlots);
+    free(map.pEntries);
+}
+
+static uint32_t _class_of(const Candidate* pCandidate, uint32_t size) {
+    uint32_t rounded = UT_MAX(size, 1u << pCandidate->minShift);
+    return UT_BIT_SCAN_REVERSE(rounded - 1) + 1 - pCandidate->minShift;
+}
+
+static uint64_t _heap_block_size(uint32_t size) {
+    uint64_t payload = ((uint64_t)UT_MAX(size, (uint32_t)REPLAY_HEAP_ALIGNMENT) + REPLAY_HEAP_ALIGNMENT - 1) & ~(uint64_t)(REPLAY_HEAP_ALIGNMENT - 1);
+    return payload + REPLAY_HEAP_HEADER;
+}
+
+/* Footprint model: pools keep their peak committed, the heap is charged its peak live blocks. */
+static void _measure(const Trace* pTrace, Candidate* pCandidate) {
+    uint64_t liveBlocks[REPLAY_MAX_CLASSES] = { 0 };
+    uint64_t heapLive = 0;
+    uint32_t maxSize = 1u << pCandidate->maxShift;
+    memset(pCandidate->classPeakBlocks, 0, sizeof(pCandidate->classPeakBlocks));
+    pCandidate->heapPeak = 0;
+    pCandidate->requestedBytes = 0;
+    pCandidate->allocatedBytes = 0;
+    for (uint32_t index = 0; index < pTrace->count; ++index) {
+        uint8_t op = pTrace->pRecords[index].op;
+        if (pTrace->pSlots[index] == UINT32_MAX) continue;
+        uint32_t size = pTrace->pSizes[index];
+        if (_is_alloc(op)) {
+            pCandidate->requestedBytes += size;
+            if (size <= maxSize) {
+                uint32_t sizeClass = _class_of(pCandidate, size);
+                pCandidate->allocatedBytes += (uint64_t)1 << (pCandidate->minShift + sizeClass);
+                liveBlocks[sizeClass]++;
+                pCandidate->classPeakBlocks[sizeClass] = UT_MAX(pCandidate->classPeakBlocks[sizeClass], liveBlocks[sizeClass]);
+            } else {
+                pCandidate->allocatedBytes += _heap_block_size(size);
+                heapLive += _heap_block_size(size);
+                pCandidate->heapPeak = UT_MAX(pCandidate->heapPeak, heapLive);
+            }
+        } else if (size <= maxSize) {
+            liveBlocks[_class_of(pCandidate, size)]--;
+        } else {
+            heapLive -= _heap_block_size(size);
+        }
+    }
+    pCandidate->poolFootprint = 0;
+    for (uint32_t index = 0; index <= pCandidate->maxShift - pCandidate->minShift; ++index) {
+        uint64_t bytes = pCandidate->classPeakBlocks[index] << (pCandidate->minShift + index);
+        pCandidate->poolFootprint += (bytes + REPLAY_POOL_GRANULE - 1) & ~(REPLAY_POOL_GRANULE - 1);
+    }
+    pCandidate->footprint = pCandidate->poolFootprint + pCandidate->heapPeak;
+}
+
+static float64_t _time_ns(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (float64_t)time.tv_sec * 1e9 + (float64_t)time.tv_nsec;
+}
+
+/*
+ Replays the trace on segregated free lists sized from the measured peaks, the same
+ structure the runtime pools use minus their thread caches, with malloc standing in for
+ the heap. Only the relative cost between candidates is meaningful.
+*/
+static void _time_replay(const Trace* pTrace, Candidate* pCandidate) {
+    uint32_t classCount = pCandidate->maxShift - pCandidate->minShift + 1;
+    uint32_t maxSize = 1u << pCandidate->maxShift;
+    byte_t* pArenas[REPLAY_MAX_CLASSES];
+    void** ppSlots = (void**)calloc(UT_MAX(pTrace->slotCount, 1u), sizeof(void*));
+    byte_t* pHeapSlots = (byte_t*)calloc(UT_MAX(pTrace->slotCount, 1u), 1);
+    float64_t best = 0.0;
+    for (uint32_t run = 0; run < REPLAY_TIMING_RUNS; ++run) {
+        void* pFreeLists[REPLAY_MAX_CLASSES] = { 0 };
+        byte_t* pBumps[REPLAY_MAX_CLASSES];
+        for (uint32_t index = 0; index < classCount; ++index) {
+            pArenas[index] = (byte_t*)malloc(UT_MAX(pCandidate->classPeakBlocks[index], 1ull) << (pCandidate->minShift + index));
+            pBumps[index] = pArenas[index];
+        }
+        float64_t start = _time_ns();
+        for (uint32_t index = 0; index < pTrace->count; ++index) {
+            uint32_t slot = pTrace->pSlots[index];
+            if (slot == UINT32_MAX) continue;
+            uint32_t size = pTrace->pSizes[index];
+            if (_is_alloc(pTrace->pRecords[index].op)) {
+                void* p;
+                if (size <= maxSize) {
+                    uint32_t sizeClass = _class_of(pCandidate, size);
+                    p = pFreeLists[sizeClass];
+                    if (p != NULL) {
+                        pFreeLists[sizeClass] = *(void**)p;
+                    } else {
+                        p = pBumps[sizeClass];
+                        pBumps[sizeClass] += (size_t)1 << (pCandidate->minShift + sizeClass);
+                    }
+                } else {
+                    p = malloc(size);
+                }
+                *(volatile byte_t*)p = 0;
+                ppSlots[slot] = p;
+                pHeapSlots[slot] = size > maxSize;
+            } else {
+                void* p = ppSlots[slot];
+                if (size <= maxSize) {
+                    uint32_t sizeClass = _class_of(pCandidate, size);
+                    *(void**)p = pFreeLists[sizeClass];
+                    pFreeLists[sizeClass] = p;
+                } else {
+                    free(p);
+                }
+                ppSlots[slot] = NULL;
+            }
+        }
+        float64_t elapsed = _time_ns() - start;
+        best = run == 0 ? elapsed : UT_MIN(best, elapsed);
+        /* Blocks still live at the end of the trace were never freed, release the heap ones. */
+        for (uint32_t slot = 0; slot < pTrace->slotCount; ++slot) {
+            if (ppSlots[slot] != NULL && pHeapSlots[slot]) free(ppSlots[slot]);
+            ppSlots[slot] = NULL;
+        }
+        for (uint32_t index = 0; index < classCount; ++index) free(pArenas[index]);
+    }
+    uint32_t opCount = 0;
+    for (uint32_t index = 0; index < pTrace->count; ++index) opCount += pTrace->pSlots[index] != UINT32_MAX;
+    pCandidate->nsPerOp = opCount > 0 ? best / (float64_t)opCount : 0.0;
+    free(ppSlots);
+    free(pHeapSlots);
+}
+
+static void _report_linear(const Trace* pTrace) {
+    LinearPeak peaks[REPLAY_MAX_LINEAR_CONTEXTS];
+    uint64_t used[REPLAY_MAX_LINEAR_CONTEXTS];
+    uint32_t contextCount = 0;
+    for (uint32_t index = 0; index < pTrace->count; ++index) {
+        const MemTraceRecord* pRecord = &pTrace->pRecords[index];
+        if (pRecord->op != MEM_TRACE_LINEAR_ALLOC && pRecord->op != MEM_TRACE_LINEAR_RESET) continue;
+        uint32_t context = 0;
+        while (context < contextCount && peaks[context].address != pRecord->address) ++context;
+        if (context == contextCount) {
+            if (contextCount == REPLAY_MAX_LINEAR_CONTEXTS) continue;
+            peaks[contextCount].address = pRecord->address;
+            peaks[contextCount].peak = 0;
+            used[contextCount++] = 0;
+        }
+        used[context] = pRecord->op == MEM_TRACE_LINEAR_ALLOC ? used[context] + pRecord->size : pRecord->size;
+        peaks[context].peak = UT_MAX(peaks[context].peak, used[context]);
+    }
+    for (uint32_t context = 0; context < contextCount; ++context) {
+        printf("linear context 0x%" PRIx64 ": peak %" PRIu64 " bytes\n", peaks[context].address, peaks[context].peak);
+    }
+}
+
+static int32_t _write_header(const char* pPath, const char* pTracePath, const Trace* pTrace, const Candidate* pBest) {
+    FILE* pFile = fopen(pPath, "w");
+    if (pFile == NULL) {
+        fprintf(stderr, "Can't write %s\n", pPath);
+        return 0;
+    }
+    fprintf(pFile, "/* Generated by mem_replay from %s (%u allocations over %u frames), do not edit. */\n", pTracePath, pTrace->allocCount, pTrace->frameCount);
+    fprintf(pFile, "#ifndef _CONFIG_MEM_POOLS_H_\n#define _CONFIG_MEM_POOLS_H_\n\n");
+    fprintf(pFile, "#define MEM_POOL_MIN_SIZE_SHIFT %u\n", pBest->minShift);
+    fprintf(pFile, "#define MEM_POOL_MAX_SIZE_SHIFT %u\n", pBest->maxShift);
+    fprintf(pFile, "/* Peak bytes every class reached in the trace. */\n#define MEM_POOL_INITIAL_COMMIT {");
+    for (uint32_t index = 0; index <= pBest->maxShift - pBest->minShift; ++index) {
+        fprintf(pFile, "%s %" PRIu64, index > 0 ? "," : "", pBest->classPeakBlocks[index] << (pBest->minShift + index));
+    }
+    fprintf(pFile, " }\n\n#endif\n");
+    fclose(pFile);
+    return 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s trace.bin [config_mem_pools.h]\n", argv[0]);
+        return 1;
+    }
+    const char* pHeaderPath = argc > 2 ? argv[2] : "config_mem_pools.h";
+    Trace trace = { 0 };
+    if (!_load_trace(argv[1], &trace)) return 1;
+    _resolve_trace(&trace);
+    printf("%u records, %u allocations, %u frames, recorded with classes %u..%u bytes\n", trace.count, trace.allocCount, trace.frameCount,
+           1u << trace.header.poolMinSizeShift, 1u << trace.header.poolMaxSizeShift);
+    _report_linear(&trace);
+
+    Candidate best = { 0 };
+    int32_t hasBest = 0;
+    printf("%-12s %12s %12s %12s %9s %9s\n", "classes", "footprint", "pools", "heap peak", "int frag", "ns/op");
+    for (uint32_t minShift = REPLAY_MIN_SHIFT_FIRST; minShift <= REPLAY_MIN_SHIFT_LAST; ++minShift) {
+        for (uint32_t maxShift = minShift; maxShift <= REPLAY_MAX_SHIFT_LAST && maxShift - minShift < REPLAY_MAX_CLASSES; ++maxShift) {
+            Candidate candidate = { 0 };
+            candidate.minShift = minShift;
+            candidate.maxShift = maxShift;
+            _measure(&trace, &candidate);
+            _time_replay(&trace, &candidate);
+            float64_t fragmentation = candidate.allocatedBytes > 0 ? 1.0 - (float64_t)candidate.requestedBytes / (float64_t)candidate.allocatedBytes : 0.0;
+            char name[32];
+            snprintf(name, sizeof(name), "%u..%u", 1u << minShift, 1u << maxShift);
+            printf("%-12s %12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %8.1f%% %9.1f\n", name, candidate.footprint, candidate.poolFootprint,
+                   candidate.heapPeak, fragmentation * 100.0, candidate.nsPerOp);
+            int32_t smaller = !hasBest || candidate.footprint + REPLAY_FOOTPRINT_SLACK < best.footprint;
+            int32_t tied = hasBest && candidate.footprint <= best.footprint + REPLAY_FOOTPRINT_SLACK && candidate.nsPerOp < best.nsPerOp;
+            if (smaller || tied) {
+                best = candidate;
+                hasBest = 1;
+            }
+        }
+    }
+    printf("best: %u..%u bytes, footprint %" PRIu64 " bytes\n", 1u << best.minShift, 1u << best.maxShift, best.footprint);
+    int32_t result = _write_header(pHeaderPath, argv[1], &trace, &best) ? 0 : 1;
+    if (result == 0) printf("wrote %s\n", pHeaderPath);
+
+    free(trace.pRecords);
+    free(trace.pSlots);
+    free(trace.pSizes);
+    return result;
+}
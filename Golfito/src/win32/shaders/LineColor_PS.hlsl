@@ -1,8 +0,0 @@
-struct PixelInput {
-	float4 position : SV_POSITION;
-	float4 color : COLOR0;
-};
-
-float4 main(PixelInput input) : SV_TARGET{
-	return input.color.abgr;
-}
\ No newline at end of file